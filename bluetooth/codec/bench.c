@@ -0,0 +1,365 @@
+// Copyright 2024 Steven Buytaert
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <hci-codec.c>                                      // To time the lookup in codec4any, which is static.
+
+/*
+
+  Measures the time per packet for decoding with pkt2struct and encoding
+  the result again with struct2pkt, for a few packets as they are seen when
+  sniffing HCI traffic, and for a packet of each of the table elements, i.e.
+  all events, commands and return structures, with a count of 1 for each of
+  the variable parts. For the latter, it also times only the lookup of the
+  table element for decoding, per kind of packet. Finally, it decodes an H4
+  stream of the sniffed packets, once by cutting it into packets and calling
+  pkt2struct for each, and once with stream2structs, in batches.
+
+  With the compiled functions linked in, it first checks that each compiled
+  decoder gives the same structure as the interpreter, byte for byte, for
+  the packets of the table elements; run it after regenerating them.
+
+  Build it with and without the compiled functions and the direct index
+  linked in, to compare them with the interpreter and the binary search,
+  e.g.
+
+    gcc -O2 -Wall -I . -I .. -o bench  bench.c hci-stream.c hci-tables-64.c hci-compiled-64.c hci-index.c
+    gcc -O2 -Wall -I . -I .. -o benchi bench.c hci-stream.c hci-tables-64.c
+    ./bench [iterations]
+    ./benchi [iterations]
+
+  As it includes hci-codec.c, that one is not on the command line.
+
+*/
+
+typedef struct Pkt_t {
+  const char *  name;
+  uint8_t       size;
+  uint8_t       bytes[64];
+} Pkt_t;
+
+static const Pkt_t Sniffed[] = {
+  { "LE_Advertising_Report", 46, {
+    0x04, 0x3e, 0x2b, 0x02, 0x02, 0x00, 0x00, 0x21, 0xf9, 0x98, 0x18, 0x6f, 0x3b, 0x15, 0x02, 0x01,
+    0x06, 0x03, 0x02, 0x09, 0x18, 0x0d, 0x08, 0x48, 0x65, 0x6c, 0x6c, 0x6f, 0x20, 0x77, 0x6f, 0x72,
+    0x6c, 0x64, 0x21, 0xcb, 0x04, 0x00, 0x21, 0xf9, 0x98, 0x18, 0x6f, 0x3b, 0x00, 0xcb } },
+  { "LE_Connection_Complete", 22, {
+    0x04, 0x3e, 0x13, 0x01, 0x00, 0x40, 0x00, 0x00, 0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x18,
+    0x00, 0x00, 0x00, 0xc8, 0x00, 0x00 } },
+  { "Number_Of_Completed_Packets", 8, {
+    0x04, 0x13, 0x05, 0x01, 0x40, 0x00, 0x01, 0x00 } },
+  { "Disconnection_Complete", 7, {
+    0x04, 0x05, 0x04, 0x00, 0x40, 0x00, 0x13 } },
+  { "Command_Status", 7, {
+    0x04, 0x0f, 0x04, 0x00, 0x01, 0x0c, 0x20 } },
+  { "Read_BD_ADDR return", 13, {
+    0x04, 0x0e, 0x0a, 0x01, 0x09, 0x10, 0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66 } },
+  { "LE_Set_Scan_Enable", 6, {
+    0x01, 0x0c, 0x20, 0x02, 0x01, 0x00 } },
+};
+
+static uint8_t All[1024][255];                              // A packet for each table element.
+static uint8_t Kind[1024];                                  // 0 for an event, 1 for a return, 2 for a command.
+static uint8_t space4dec[2048] __attribute__((aligned (8)));
+static uint8_t encoded[512];
+static uint8_t Stream[64 * 1024];                           // H4 stream of sniffed packets.
+static uint8_t arena[16 * 1024] __attribute__((aligned (8)));
+static StreamPkt_t Pkts[256];
+
+static uint64_t nanos(void) {
+
+  struct timespec Ts;
+
+  clock_gettime(CLOCK_MONOTONIC, & Ts);
+
+  return (uint64_t) Ts.tv_sec * 1000000000ULL + (uint64_t) Ts.tv_nsec;
+
+}
+
+static uint32_t synthesize(void) {                          // Fill All[] with a packet per table element; return the number.
+
+  uint32_t     num = 0;
+  uint32_t     t;
+  uint32_t     i;
+  te_t         te;
+  HCI_Opcode_t Opc;
+  uint8_t *    p;
+
+  for (t = 0; t < NUM(ctabs); t++) {
+    for (i = 0; i < ctabs[t]->numtab; i++) {
+      te = & ctabs[t]->table[i];
+      p = All[num];
+      memset(p, 0x01, sizeof(All[0]));                      // Any count is 1.
+      Opc.OGF = t;
+      Opc.OCF = te->OCF;
+      if (0 == t) {
+        if (0x0e == te->code && ! te->issub) { continue; }  // Command Complete; covered by the returns.
+        p[0] = type_EVT;
+        p[1] = te->issub ? 0x3e : te->code;
+        p[2] = sizeof(All[0]) - 3;
+        if (te->issub) { p[3] = te->code; }
+        Kind[num] = 0;
+      }
+      else if (te->isret) {
+        p[0] = type_EVT;
+        p[1] = 0x0e;
+        p[2] = sizeof(All[0]) - 3;
+        p[4] = (uint8_t) Opc.opcode;
+        p[5] = (uint8_t) (Opc.opcode >> 8);
+        Kind[num] = 1;
+      }
+      else {
+        p[0] = type_CMD;
+        p[1] = (uint8_t) Opc.opcode;
+        p[2] = (uint8_t) (Opc.opcode >> 8);
+        p[3] = sizeof(All[0]) - 4;
+        Kind[num] = 2;
+      }
+      num++;
+    }
+  }
+
+  return num;
+
+}
+
+static uint32_t interpret(codecreq_t req, ctab_t ctab, te_t entry) {  // As pkt2struct, without trying the compiled decoder.
+
+  Fixup_t    Fixup[32];
+  CodecCtx_t Ctx = {
+    .Src = { .start = req->Pkt.buf, .cur = req->Pkt.buf, .limit = req->Pkt.buf + req->Pkt.sz, .status = & req->Pkt.status },
+    .Dst = { .start = req->Struct.buf, .cur = req->Struct.buf, .limit = req->Struct.buf + req->Struct.sz, .status = & req->Struct.status },
+    .entry    = entry,
+    .numc     = entry->numcoi,
+    .codec    = & ctab->CoI[entry->coistart],
+    .Fixup    = Fixup,
+    .fixcap   = NUM(Fixup),
+    .decoding = 1,
+    .ccopy    = docopy,
+  };
+
+  req->Pkt.status = 0;
+  req->Struct.status = 0;
+
+  intdecode(& Ctx);
+
+  return Ctx.Src.status[0] || Ctx.Dst.status[0] ? 0 : (uint32_t) (Ctx.Dst.cur - Ctx.Dst.start);
+
+}
+
+static void verify(uint32_t num) {                          // Compiled decoders must give the same bytes as the interpreter.
+
+  static uint8_t    compiled4cmp[sizeof(space4dec)] __attribute__((aligned (8)));
+  CodecReq_t        Req = { .Struct.buf = space4dec, .Struct.sz = sizeof(space4dec) };
+  const CodecFun_t * cfun;
+  te_t              entry;
+  ctab_t            ctab;
+  uint8_t           ti;
+  uint32_t          same = 0;
+  uint32_t          differ = 0;
+  uint32_t          csize;
+  uint32_t          isize;
+  uint32_t          i;
+
+  for (i = 0; i < num; i++) {
+    Req.Pkt.buf = All[i];
+    Req.Pkt.sz = (uint16_t) (type_EVT == All[i][0] ? 3 + All[i][2] : 4 + All[i][3]);
+    entry = codec4dec(All[i], & ctab, & ti);
+    cfun = entry ? compiled(ti, ctab, entry) : NULL;
+    if (! cfun || ! cfun->dec) { continue; }
+    memset(space4dec, 0xa5, sizeof(space4dec));             // Into the same place, so that the pointers are the same.
+    csize = cfun->dec(space4dec, sizeof(space4dec), All[i], Req.Pkt.sz);
+    if (! csize) { continue; }                              // Falls back to the interpreter anyway.
+    memcpy(compiled4cmp, space4dec, csize);
+    memset(space4dec, 0xa5, sizeof(space4dec));
+    isize = interpret(& Req, ctab, entry);
+    if (isize == csize && ! memcmp(compiled4cmp, space4dec, csize)) {
+      same++;
+    }
+    else {
+      printf("element %u of table %u: compiled %u bytes, interpreted %u bytes, differ.\n", (uint32_t) (entry - ctab->table), ti, csize, isize);
+      differ++;
+    }
+  }
+
+  printf("verify: %u compiled decoders give the same structure as the interpreter, %u differ.\n", same, differ);
+
+}
+
+static void run(const char * name, const uint8_t * pkts[], const uint8_t sizes[], uint32_t num, uint32_t iterations) {
+
+  CodecReq_t DReq = { .Struct.buf = space4dec, .Struct.sz = sizeof(space4dec) };
+  CodecReq_t EReq = { .Struct.buf = space4dec, .Struct.sz = sizeof(space4dec), .Pkt.buf = encoded, .Pkt.sz = sizeof(encoded) };
+  uint64_t   dec = 0;
+  uint64_t   enc = 0;
+  uint64_t   start;
+  uint32_t   failed = 0;
+  uint32_t   i;
+  uint32_t   n;
+
+  for (i = 0; i < num; i++) {
+    DReq.Pkt.buf = (uint8_t *) pkts[i];
+    DReq.Pkt.sz = sizes[i];
+    if (! pkt2struct(& DReq)) { failed++; continue; }       // Don't time what fails.
+
+    start = nanos();
+    for (n = 0; n < iterations; n++) {
+      pkt2struct(& DReq);
+    }
+    dec += nanos() - start;
+
+    start = nanos();
+    for (n = 0; n < iterations; n++) {
+      struct2pkt(& EReq);
+    }
+    enc += nanos() - start;
+  }
+
+  num -= failed;
+  printf("%-28s %5u %10.1f %10.1f\n", name, num, (double) dec / num / iterations, (double) enc / num / iterations);
+
+}
+
+static void lookup(const char * name, uint32_t kind, uint32_t num, uint32_t iterations) {
+
+  const uint8_t * pkts[1024];
+  uint32_t        n = 0;
+  uint32_t        i;
+  uint32_t        it;
+  uint64_t        start;
+  uint64_t        found = 0;
+  ctab_t          ctab;
+  uint8_t         ti;
+
+  for (i = 0; i < num; i++) {
+    if (kind == Kind[i]) { pkts[n++] = All[i]; }
+  }
+
+  start = nanos();
+  for (it = 0; it < iterations; it++) {
+    for (i = 0; i < n; i++) {
+      found += codec4dec(pkts[i], & ctab, & ti) ? 1 : 0;
+    }
+  }
+  start = nanos() - start;
+
+  if (found != (uint64_t) n * iterations) { printf("%s: not all found.\n", name); }
+
+  printf("%-28s %5u %10.1f\n", name, n, (double) start / n / iterations);
+
+}
+
+static void stream(uint32_t iterations) {
+
+  CodecReq_t  DReq;
+  StreamReq_t SReq = { .Arena.buf = arena, .Arena.sz = sizeof(arena), .Pkts.buf = Pkts, .Pkts.cap = NUM(Pkts) };
+  uint32_t    size = 0;
+  uint32_t    num = 0;
+  uint32_t    done = 0;
+  uint32_t    framed = 0;
+  uint32_t    decoded = 0;
+  uint32_t    used;
+  uint32_t    sz;
+  uint32_t    at;
+  uint32_t    it;
+  uint64_t    start;
+  uint64_t    cut;
+  uint64_t    batched;
+  const Pkt_t * pkt;
+
+  for (pkt = Sniffed; size + pkt->size <= sizeof(Stream); num++) {
+    memcpy(Stream + size, pkt->bytes, pkt->size);
+    size += pkt->size;
+    pkt = (pkt == & Sniffed[NUM(Sniffed) - 1]) ? Sniffed : pkt + 1;
+  }
+
+  start = nanos();
+  for (it = 0; it < iterations; it++) {                     // Cut it up, as a caller would without stream2structs.
+    for (used = 0, at = 0; at < size; at += DReq.Pkt.sz) {
+      DReq.Pkt.buf = Stream + at;
+      DReq.Pkt.sz = (uint16_t) (type_EVT == Stream[at] ? 3 + Stream[at + 2] : 4 + Stream[at + 3]);
+      if (used + 512 > sizeof(arena)) { used = 0; }         // Into the arena as well, for the same cache behaviour.
+      DReq.Struct.buf = arena + used;
+      DReq.Struct.sz = 512;
+      sz = pkt2struct(& DReq);
+      used = (used + sz + 7) & ~7u;
+      done += sz ? 1 : 0;
+    }
+  }
+  cut = nanos() - start;
+
+  start = nanos();
+  for (it = 0; it < iterations; it++) {
+    for (at = 0; at < size; at += SReq.Stream.used) {
+      SReq.Stream.buf = Stream + at;
+      SReq.Stream.sz = size - at;
+      stream2structs(& SReq);
+    }
+  }
+  batched = nanos() - start;
+
+  for (at = 0; at < size; at += SReq.Stream.used) {         // Once more, to check it, untimed.
+    SReq.Stream.buf = Stream + at;
+    SReq.Stream.sz = size - at;
+    framed += stream2structs(& SReq);
+    for (sz = 0; sz < SReq.Pkts.num; sz++) {
+      decoded += Pkts[sz].str ? 1 : 0;
+    }
+  }
+
+  if (done != num * iterations) { printf("stream: not all decoded by pkt2struct.\n"); }
+  if (framed != num || decoded != num || SReq.Stream.need) { printf("stream: stream2structs framed %u and decoded %u of %u.\n", framed, decoded, num); }
+
+  printf("%-28s %5u %10.1f\n", "cut, pkt2struct each", num, (double) cut / num / iterations);
+  printf("%-28s %5u %10.1f\n", "stream2structs", num, (double) batched / num / iterations);
+
+}
+
+int main(int argc, char * argv[]) {
+
+  uint32_t        iterations = argc > 1 ? (uint32_t) atoi(argv[1]) : 100000;
+  const uint8_t * pkts[1024];
+  uint8_t         sizes[1024];
+  uint32_t        num;
+  uint32_t        i;
+
+  printf("codec: %s\n\n", cfuns ? "compiled" : "interpreted");
+  printf("%-28s %5s %10s %10s\n", "packet", "num", "dec ns", "enc ns");
+
+  for (i = 0; i < NUM(Sniffed); i++) {
+    pkts[0] = Sniffed[i].bytes;
+    sizes[0] = Sniffed[i].size;
+    run(Sniffed[i].name, pkts, sizes, 1, iterations);
+  }
+
+  num = synthesize();
+  for (i = 0; i < num; i++) {
+    pkts[i] = All[i];
+    sizes[i] = sizeof(All[0]);
+  }
+
+  run("all table elements", pkts, sizes, num, iterations / 100 + 1);
+
+  if (cfuns) {
+    printf("\n");
+    verify(num);
+  }
+
+  printf("\nlookup: %s\n\n", cidx ? "direct index" : "binary search");
+  printf("%-28s %5s %10s\n", "packet", "num", "ns");
+
+  lookup("events and subevents", 0, num, iterations / 10 + 1);
+  lookup("command complete returns", 1, num, iterations / 10 + 1);
+  lookup("commands", 2, num, iterations / 10 + 1);
+
+  printf("\nstream\n\n");
+  printf("%-28s %5s %10s\n", "packet", "num", "ns");
+
+  stream(iterations / 1000 + 1);
+
+  return 0;
+
+}
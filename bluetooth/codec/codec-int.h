@@ -78,6 +78,30 @@ typedef CONST struct CodecTab_t {
 
 extern const ctab_t ctabs[9];     // Defined in generated hci-tables.c file.
 
+// A compiled decoder or encoder for a table element; returns the size of the
+// decoded structure or encoded packet, or 0 when it could not do it; the
+// interpreter then takes over. See hci-coi2c.c.
+
+typedef uint32_t (* cfun_t)(uint8_t * dst, uint32_t dsz, const uint8_t * src, uint32_t ssz);
+
+typedef struct CodecFun_t {
+  cfun_t            dec;          // NULL when not compiled.
+  cfun_t            enc;          // NULL when not compiled.
+} CodecFun_t;
+
+extern const CodecFun_t * const cfuns[9];  // Same index as ctabs; in generated hci-compiled.c file, if linked in.
+
+// A direct index of a table; for each event code or OCF, and for issub or
+// isret 0 and 1, the index of the table element plus 1, or 0 when there is
+// no such element. See hci-coi2c.c.
+
+typedef struct CodecIdx_t {
+  uint16_t          num;          // Number of event codes or OCFs covered; 0 for an empty table.
+  const uint8_t  (* idx)[2];      // [code or OCF][issub or isret]
+} CodecIdx_t;
+
+extern const CodecIdx_t cidx[9];  // Same index as ctabs; in generated hci-index.c file, if linked in.
+
 typedef int32_t (* cmpte_t)(te_t a, te_t b);
 
 inline static int32_t cmpevt(te_t a, te_t b) {
@@ -100,4 +124,6 @@ inline static int32_t cmpcmd(te_t a, te_t b) {
 
 }
 
+te_t codec4dec(const uint8_t pkt[], ctab_t tr[1], uint8_t ti[1]);  // Table element for an H4 packet; in hci-codec.c.
+
 #endif // HCI_CODEC_INT_H
@@ -9,6 +9,9 @@
 
 #define NUM(A) (sizeof(A) / sizeof(A[0]))
 
+extern const CodecFun_t * const cfuns[9] __attribute__((weak));  // NULL unless compiled functions are linked in.
+extern const CodecIdx_t cidx[9] __attribute__((weak));      // NULL unless the direct index is linked in.
+
 typedef struct CodecCtx_t * cctx_t;
 
 typedef struct Fixup_t {
@@ -70,6 +73,24 @@ static te_t search4te(ctab_t tab, te_t key, cmpte_t cf) {
 
 }
 
+static te_t find4te(uint8_t ti, ctab_t tab, te_t key, cmpte_t cf, uint32_t code, uint32_t flag) {
+
+  const CodecIdx_t * idx = cidx ? & cidx[ti] : NULL;
+  uint32_t           i;
+
+  if (idx && idx->num) {                                    // Direct index; code is the full event code or OCF.
+    i = code < idx->num ? idx->idx[code][flag] : 0;
+    return i ? & tab->table[i - 1] : NULL;
+  }
+
+  if (code > (cmpevt == cf ? 0x7fu : 0xffu)) {              // Beyond the key fields; not in the tables, as with the index.
+    return NULL;
+  }
+
+  return search4te(tab, key, cf);                           // No index linked in.
+
+}
+
 static uint32_t ru16(const uint8_t pkt[]) {                 // Read an uint16_t size from the packet.
   return (uint32_t) ((pkt[1] << 8) | pkt[0]);               // Little endian encoding.
 }
@@ -84,7 +105,7 @@ static ctab_t opcode2tab(const HCI_Opcode_t * opc) {
 
 }
 
-static ctab_t tab4codec(const void * sop, uint32_t e4d, uint8_t tr[1]) {
+static ctab_t tab4codec(const void * sop, uint32_t e4d, uint8_t tr[1], uint8_t ti[1]) {
 
   const uint8_t * u08 = (const uint8_t *) sop;
   uint8_t         type = u08 ? u08[0] : 0xff;               // Get the proper type first.
@@ -97,11 +118,13 @@ static ctab_t tab4codec(const void * sop, uint32_t e4d, uint8_t tr[1]) {
       case type_CMD: {
         if (e4d) { Opc.opcode = ru16(& u08[1]); }           // Decoding: get it from the unaligned stream.
         else { Opc.opcode = ((HCI_Cmd_t *) u08)->opcode; }  // Encoding: get it from the structure.
+        ti[0] = Opc.OGF;
         return opcode2tab(& Opc);
         break;
       }
       
       case type_EVT: {
+        ti[0] = 0;
         return ctabs[0];
         break;
       }
@@ -116,10 +139,10 @@ static ctab_t tab4codec(const void * sop, uint32_t e4d, uint8_t tr[1]) {
 
 typedef HCI_Command_Complete_Evt_t CCEvt_t;                 // Shorthand notation.
 
-static te_t codec4any(const uint8_t any[], uint32_t e4d, ctab_t tr[1]) {  // Search proper entry for encoding or decoding.
+static te_t codec4any(const uint8_t any[], uint32_t e4d, ctab_t tr[1], uint8_t ti[1]) {  // Search proper entry for encoding or decoding.
 
   uint8_t        type;
-  ctab_t         ctab = tab4codec(any, e4d, & type);
+  ctab_t         ctab = tab4codec(any, e4d, & type, ti);
   TE_t           Key;
   te_t           fnd = NULL;
   HCI_Opcode_t   Opc;
@@ -136,19 +159,20 @@ static te_t codec4any(const uint8_t any[], uint32_t e4d, ctab_t tr[1]) {  // Sea
         ctab = opcode2tab(& Opc);
         if (ctab) {
           tr[0] = ctab;
-          fnd = search4te(ctab, & Key, cmpcmd);
+          ti[0] = Opc.OGF;
+          fnd = find4te(ti[0], ctab, & Key, cmpcmd, Opc.OCF, 1);
         }
       }
       else if (0x3e == evt->code) {                         // Search on the subevent.
         Key.code = evt->subevent[0];
         Key.issub = 1;
-        fnd = search4te(ctab, & Key, cmpevt);
+        fnd = find4te(ti[0], ctab, & Key, cmpevt, evt->subevent[0], 1);
         assert(! fnd || fnd->issub);
       }
       else {                                                // Search on the event code.
         Key.code = evt->code;
         Key.issub = 0;
-        fnd = search4te(ctab, & Key, cmpevt);
+        fnd = find4te(ti[0], ctab, & Key, cmpevt, evt->code, 0);
         assert(! fnd || ! fnd->issub);
       }
     }
@@ -157,7 +181,7 @@ static te_t codec4any(const uint8_t any[], uint32_t e4d, ctab_t tr[1]) {  // Sea
       else { opc->opcode = ((HCI_Cmd_t *) any)->opcode; }   // Encoding: get it from the structure.
       Key.OCF = opc->OCF;
       Key.isret = 0;                                        // Otherwise would be an event.
-      fnd = search4te(ctab, & Key, cmpcmd);
+      fnd = find4te(ti[0], ctab, & Key, cmpcmd, opc->OCF, 0);
     }
   }
   
@@ -165,12 +189,22 @@ static te_t codec4any(const uint8_t any[], uint32_t e4d, ctab_t tr[1]) {  // Sea
 
 }
 
-static te_t codec4enc(const void * s2e, ctab_t tr[1]) {     // Search proper entry for encoding.
-  return codec4any(s2e, 0, tr);
+static te_t codec4enc(const void * s2e, ctab_t tr[1], uint8_t ti[1]) {  // Search proper entry for encoding.
+  return codec4any(s2e, 0, tr, ti);
+}
+
+te_t codec4dec(const uint8_t pkt[], ctab_t tr[1], uint8_t ti[1]) {  // Search proper entry for decoding.
+  return codec4any(pkt, 1, tr, ti);
 }
 
-static te_t codec4dec(const uint8_t pkt[], ctab_t tr[1]) {  // Search proper entry for decoding.
-  return codec4any(pkt, 1, tr);
+static const CodecFun_t * compiled(uint8_t ti, ctab_t ctab, te_t entry) {  // Compiled functions for the entry, if any.
+
+  if (cfuns && cfuns[ti]) {
+    return & cfuns[ti][entry - ctab->table];
+  }
+
+  return NULL;
+
 }
 
 static void nocopy(void * dst, const void * src, uint32_t sz) { }
@@ -258,6 +292,17 @@ static void copy(cctx_t ctx, uint32_t b2c, uint32_t skip) { // Copy and skip if
 
 }
 
+static codec_t skip2end(codec_t codec, codec_t end) {      // Skip a loop body for a 0 count loop; return the endloop.
+
+  for ( ; codec < end; codec++) {
+    if (codec->inst && endloop == codec->action) { break; } // Only an instruction can end it; not a copy.
+    if (codec->inst && copyws == codec->action) { codec += 2; }  // Don't look at the size bytes.
+  }
+
+  return codec;
+
+}
+
 typedef struct Loop_t {
   const CoI_t *   start;          // Start of the loop.
   uint16_t        count;          // Loop counter.
@@ -274,7 +319,8 @@ static void intdecode(cctx_t ctx) {                         // Internal decoder.
   Loop_t     Loop[2];
   uint8_t    actloop = 0xff;                                // Active loop index when not 0xff.
   
-  for (CoI = *codec; codec < end; codec++, CoI = *codec) {  // Go over the instruction stream.
+  for ( ; codec < end; codec++) {                          // Go over the instruction stream.
+    CoI = *codec;                                           // Not before the check; end is not readable.
     if (ctx->Src.status[0] || ctx->Dst.status[0]) break;    // Stop at error.
     if (CoI.inst) {                                         // An action to perform.
       switch (CoI.action) {
@@ -325,9 +371,7 @@ static void intdecode(cctx_t ctx) {                         // Internal decoder.
           ctx->bitsset = 0;                                 // Reset in any case.
           if (0 == count) {                                 // Nothing to loop, skip until endloop.
             actloop--;
-            for ( ; codec < end; codec++, CoI = *codec) {
-              if (endloop == CoI.action) { break; }         // Ended 0 count loop.
-            }
+            codec = skip2end(codec + 1, end);               // Ended 0 count loop.
           }
           break;
         }
@@ -397,7 +441,8 @@ static void intencode(cctx_t ctx) {                         // Internal encoder.
   void *     from;
   uint32_t   add2cur = 0;
   
-  for (CoI = *codec; codec < end; codec++, CoI = *codec) {  // Go over the instruction stream.
+  for ( ; codec < end; codec++) {                          // Go over the instruction stream.
+    CoI = *codec;                                           // Not before the check; end is not readable.
     if (ctx->Src.status[0] || ctx->Dst.status[0]) break;    // Stop at error.
     if (CoI.inst) {                                         // An action to perform.
       switch (CoI.action) {
@@ -444,9 +489,7 @@ static void intencode(cctx_t ctx) {                         // Internal encoder.
           ctx->bitsset = 0;                                 // Reset in any case.
           if (0 == count) {                                 // Nothing to loop, skip until endloop.
             actloop--;
-            for ( ; codec < end; codec++, CoI = *codec) {
-              if (endloop == CoI.action) { break; }         // Ended 0 count loop.
-            }
+            codec = skip2end(codec + 1, end);               // Ended 0 count loop.
           }
           break;
         }
@@ -499,6 +542,9 @@ uint32_t pkt2struct(codecreq_t req) {
 
    Fixup_t    Fixup[32];
    ctab_t     ctab;
+   uint8_t    ti;
+   const CodecFun_t * cfun;
+   uint32_t   size;
 
    CodecCtx_t Ctx = {
     .Src = {
@@ -513,7 +559,7 @@ uint32_t pkt2struct(codecreq_t req) {
       .limit  = req->Struct.buf ? req->Struct.buf + req->Struct.sz : (void *) 1,
       .status = & req->Struct.status,
     },
-    .entry = codec4dec(req->Pkt.buf, & ctab),
+    .entry = codec4dec(req->Pkt.buf, & ctab, & ti),
     .numc     = 0,
     .codec    = NULL,
     .Fixup    = Fixup,
@@ -526,6 +572,12 @@ uint32_t pkt2struct(codecreq_t req) {
   req->Struct.status = 0;
 
   if (Ctx.entry) {
+    cfun = compiled(ti, ctab, Ctx.entry);
+    if (cfun && cfun->dec && isActive(& Ctx)) {             // Try the compiled decoder first.
+      size = cfun->dec(req->Struct.buf, req->Struct.sz, req->Pkt.buf, req->Pkt.sz);
+      if (size) { return size; }
+    }
+
     assert(Ctx.entry->numcoi);                              // Must have at least 1 instruction.
     Ctx.numc = Ctx.entry->numcoi;
     Ctx.codec = & ctab->CoI[Ctx.entry->coistart];
@@ -546,7 +598,9 @@ uint32_t struct2pkt(codecreq_t req) {
 
    Fixup_t    Fixup[32];
    ctab_t     ctab;
-   uint32_t   encsize;
+   uint8_t    ti;
+   const CodecFun_t * cfun;
+   uint32_t   encsize = 0;
 
 // Same as decode, just Dec/Enc reversed and a different search function
 
@@ -563,7 +617,7 @@ uint32_t struct2pkt(codecreq_t req) {
       .limit  = req->Pkt.buf ? req->Pkt.buf + req->Pkt.sz : (void *) 1,
       .status = & req->Pkt.status,
     },
-    .entry = codec4enc(req->Struct.buf, & ctab), // and a different search
+    .entry = codec4enc(req->Struct.buf, & ctab, & ti), // and a different search
     .numc     = 0,
     .codec    = NULL,
     .Fixup    = Fixup,
@@ -576,12 +630,18 @@ uint32_t struct2pkt(codecreq_t req) {
   req->Struct.status = 0;
 
   if (Ctx.entry) {
-    assert(Ctx.entry->numcoi);                              // Must have at least 1 instruction.
-    Ctx.numc = Ctx.entry->numcoi;
-    Ctx.codec = & ctab->CoI[Ctx.entry->coistart];
-    intencode(& Ctx);
+    cfun = compiled(ti, ctab, Ctx.entry);
+    if (cfun && cfun->enc && isActive(& Ctx)) {             // Try the compiled encoder first.
+      encsize = cfun->enc(req->Pkt.buf, req->Pkt.sz, req->Struct.buf, req->Struct.sz);
+    }
 
-    encsize = (uint32_t) (Ctx.Dst.cur - Ctx.Dst.start);     // Size of the encoded packet.
+    if (! encsize) {                                        // Not compiled or it failed; interpret.
+      assert(Ctx.entry->numcoi);                            // Must have at least 1 instruction.
+      Ctx.numc = Ctx.entry->numcoi;
+      Ctx.codec = & ctab->CoI[Ctx.entry->coistart];
+      intencode(& Ctx);
+      encsize = (uint32_t) (Ctx.Dst.cur - Ctx.Dst.start);   // Size of the encoded packet.
+    }
 
     if (isActive(& Ctx)) {
       if (type_EVT == req->Pkt.buf[0]) {
@@ -39,4 +39,67 @@ uint32_t struct2pkt(codecreq_t req);
 
 uint32_t pkt2struct(codecreq_t req);
 
+/*
+
+  Decoding an H4 byte stream, e.g. as it comes from a UART.
+  Each packet starts with the H4 packet type byte, followed by the HCI
+  packet; since the type byte is also the first byte of the packets that
+  pkt2struct decodes, the stream is decoded in place. stream2structs frames
+  as many packets as there are in Stream.buf, decodes the commands and the
+  events into structures, one after the other in the arena, each aligned on
+  8 bytes, and adds a StreamPkt_t for each packet. Data packets (ACL, SCO
+  and ISO) are only framed; their str is NULL. A byte that is not a packet
+  type where a packet should start, is skipped.
+
+  It stops at the end of the stream, when the packet array is full or when
+  the next structure doesn't fit the arena anymore. Stream.used tells how
+  many bytes are done with; the structures refer to data in the arena only,
+  so these bytes can go. When it stopped on a partial packet at the end,
+  Stream.need is the number of bytes still missing for it, as far as known
+  from the bytes that are there, i.e. at least 1; else it is 0.
+
+  To decode straight from a circular buffer, pass the data and num of a read
+  slice as Stream.buf and Stream.sz, and consume Stream.used bytes after
+  handling the structures. With a mirrored buffer, the slice holds all there
+  is, also across the wrap point. With a plain one, a packet that straddles
+  the wrap point shows as partial, while the rest of it is at the start of
+  the buffer; copy such a packet out with bcb_read and decode that.
+
+*/
+
+typedef struct StreamPkt_t {      // A packet framed from the stream.
+  const uint8_t *  pkt;           // The packet in the stream, at the H4 type byte.
+  void *           str;           // The decoded structure in the arena; NULL when not decoded.
+  uint32_t         sz;            // Size of the packet, including the type byte.
+  uint16_t         status;        // One of the CodecReqStat_t values; CReq_OK when decoded or only framed.
+  uint16_t         rfu;
+} StreamPkt_t;
+
+typedef struct StreamReq_t * streamreq_t;
+
+typedef struct StreamReq_t {
+  struct {
+    const uint8_t *  buf;         // The bytes of the stream.
+    uint32_t         sz;
+    uint32_t         used;        // Bytes framed or skipped; set by stream2structs.
+    uint32_t         need;        // Bytes missing for a partial packet at the end; set by stream2structs.
+    uint32_t         skipped;     // Bytes that were not a packet type; set by stream2structs.
+  } Stream;
+  struct {
+    void *           buf;         // Space for the structures; aligned on 8 bytes.
+    uint32_t         sz;
+    uint32_t         used;        // Set by stream2structs.
+  } Arena;
+  struct {
+    StreamPkt_t *    buf;
+    uint32_t         cap;         // Capacity of buf.
+    uint32_t         num;         // Number of packets framed; set by stream2structs.
+  } Pkts;
+} StreamReq_t;
+
+// Frame and decode the packets in a stream; return the number of packets framed.
+// It is in hci-stream.c, to link in only when used.
+
+uint32_t stream2structs(streamreq_t req);
+
 #endif // HCI_CODEC_H
@@ -0,0 +1,371 @@
+// Copyright 2024 Steven Buytaert
+
+// To build 'gcc -Wall -I . -I .. -o coi2c hci-coi2c.c hci-tables-64.c'
+
+/*
+
+  Compiles the codec instruction streams of the generated tables into plain
+  C decode and encode functions, one per distinct instruction stream, and
+  prints them on stdout, e.g.
+
+  $ ./coi2c 64 > hci-compiled-64.c
+
+  The argument is the bit width the linked in tables were generated for; the
+  generated file can only be used with those tables. When the resulting file
+  is linked in, pkt2struct and struct2pkt call these functions instead of
+  interpreting the instructions. A stream with an instruction that is not
+  supported here, e.g. nested loops, gets no function; the interpreter then
+  handles it as before.
+
+  A generated function only handles the case where everything goes fine; on
+  any problem (too short, out of bounds, ...) it returns 0 and the caller
+  falls back to the interpreter, which then sets the proper status.
+
+  With the argument 'index', it prints direct index tables instead, e.g.
+
+  $ ./coi2c index > hci-index.c
+
+  For each table, an array indexed by event code or OCF, and by issub or
+  isret, gives the table element, so that looking up the element for a
+  packet takes a few loads instead of a binary search. The order of the
+  elements is the same for the 32 and 64 bit tables, so one file serves
+  both.
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <codec-int.h>
+
+#define NUM(A) (sizeof(A) / sizeof(A[0]))
+
+static const char preamble[] =
+  "#include <string.h>\n"
+  "#include <codec-int.h>\n"
+  "\n"
+  "// On a problem, the functions return 0, so that the interpreter takes over and sets\n"
+  "// the proper status. As the interpreter, they clear the padding bytes of a decoded\n"
+  "// structure, unless NDEBUG is defined.\n"
+  "\n"
+  "#define MAXFIX 32                 // Same capacity as the interpreter.\n"
+  "\n"
+  "typedef struct Fix_t {\n"
+  "  const uint8_t *       src;      // Inline data; NULL when the data comes after the fixed part.\n"
+  "  void * *              ref;      // Where to write the destination pointer (decoding).\n"
+  "  uint32_t              num;      // Number of bytes to copy.\n"
+  "} Fix_t;\n"
+  "\n"
+  "#define FIX(SRC)                                            \\\n"
+  "  if (c) {                                                  \\\n"
+  "    if (MAXFIX - 1 == nf) { return 0; }                     \\\n"
+  "    F[nf].src = (SRC);                                      \\\n"
+  "    F[nf].ref = (void * *) d;                               \\\n"
+  "    F[nf].num = n;                                          \\\n"
+  "    nf++;                                                   \\\n"
+  "  }\n"
+  "\n"
+  "#if defined(NDEBUG)\n"
+  "#define DPAD(SKIP)\n"
+  "#else\n"
+  "#define DPAD(SKIP) memset(d, 0x00, SKIP)\n"
+  "#endif\n"
+  "\n"
+  "#define DCOPY(N, SKIP)                                      \\\n"
+  "  if (s + (N) > se || d + (N) >= de) { return 0; }          \\\n"
+  "  if (d + (N) + (SKIP) > de) { return 0; }                  \\\n"
+  "  memcpy(d, s, N); d += (N); DPAD(SKIP); d += (SKIP); s += (N);\n"
+  "\n"
+  "#define DINLINE(ARG)                                        \\\n"
+  "  c = s[-1]; n = c * (ARG);                                 \\\n"
+  "  if (s + n > se || d + sizeof(void *) >= de) { return 0; } \\\n"
+  "  memset(d, 0x00, sizeof(void *));                          \\\n"
+  "  FIX(s);                                                   \\\n"
+  "  d += sizeof(void *); s += n;\n"
+  "\n"
+  "#define DLATER(ARG)                                         \\\n"
+  "  c = s[-1]; n = c * (ARG);                                 \\\n"
+  "  if (d + sizeof(void *) >= de) { return 0; }               \\\n"
+  "  memset(d, 0x00, sizeof(void *));                          \\\n"
+  "  FIX(NULL);                                                \\\n"
+  "  d += sizeof(void *);\n"
+  "\n"
+  "#define ECOPY(N, SKIP)                                      \\\n"
+  "  if (s + (N) > se || d + (N) >= de) { return 0; }          \\\n"
+  "  memcpy(d, s, N); d += (N); s += (N) + (SKIP);\n"
+  "\n"
+  "#define ECOPYB(N, SKIP)                                     \\\n"
+  "  if (s + (N) > se || d + (N) >= de) { return 0; }          \\\n"
+  "  memcpy(d, s, N); d += (N); s += (N); b = s; s += (SKIP);\n"
+  "\n"
+  "#define EFROM(ARG)                                          \\\n"
+  "  if (s + sizeof(void *) > se) { return 0; }                \\\n"
+  "  c = b[-1]; n = c * (ARG);                                 \\\n"
+  "  memcpy(& f, s, sizeof(f));                                \\\n"
+  "  if (n && (! f || f + n > se || f < ss)) { return 0; }     \\\n"
+  "  s += sizeof(void *);\n"
+  "\n"
+  "#define EINLINE(ARG)                                        \\\n"
+  "  EFROM(ARG);                                               \\\n"
+  "  if (d + n >= de) { return 0; }                            \\\n"
+  "  if (n) { memcpy(d, f, n); }                               \\\n"
+  "  d += n;\n"
+  "\n"
+  "#define ELATER(ARG)                                         \\\n"
+  "  EFROM(ARG);                                               \\\n"
+  "  FIX(f);\n"
+  "\n"
+  "static uint8_t * fixdec(Fix_t F[], uint32_t nf, uint8_t * d, const uint8_t * de, const uint8_t * s, const uint8_t * se) {\n"
+  "\n"
+  "  for (uint32_t i = 0; i < nf; i++) {\n"
+  "    if (d + F[i].num >= de) { return NULL; }\n"
+  "    if (F[i].src) {                                         // Data was inline.\n"
+  "      memcpy(d, F[i].src, F[i].num);\n"
+  "    }\n"
+  "    else {                                                  // Data follows the fixed part.\n"
+  "      if (s + F[i].num > se) { return NULL; }\n"
+  "      memcpy(d, s, F[i].num);\n"
+  "      s += F[i].num;\n"
+  "    }\n"
+  "    memcpy(F[i].ref, & d, sizeof(d));                       // The structure may be packed.\n"
+  "    d += F[i].num;\n"
+  "  }\n"
+  "\n"
+  "  return d;\n"
+  "\n"
+  "}\n"
+  "\n"
+  "static uint8_t * fixenc(Fix_t F[], uint32_t nf, uint8_t * d, const uint8_t * de) {\n"
+  "\n"
+  "  for (uint32_t i = 0; i < nf; i++) {\n"
+  "    if (d + F[i].num >= de) { return NULL; }\n"
+  "    if (F[i].num) { memcpy(d, F[i].src, F[i].num); }\n"
+  "    d += F[i].num;\n"
+  "  }\n"
+  "\n"
+  "  return d;\n"
+  "\n"
+  "}\n";
+
+typedef struct Scan_t {           // Result of scanning an instruction stream.
+  uint8_t  ok;                    // Non zero when it can be compiled.
+  uint8_t  count;                 // Non zero when a count is used.
+  uint8_t  fix;                   // Non zero when there are fixups.
+  uint8_t  loop;                  // Non zero when there is a loop.
+} Scan_t;
+
+static Scan_t scan(codec_t codec, uint32_t numc) {
+
+  Scan_t   Scan = { .ok = 1 };
+  uint32_t inloop = 0;
+  uint32_t copied = 0;                                      // Non zero after the first copy; a count comes from there.
+  uint32_t i;
+
+  for (i = 0; Scan.ok && i < numc; i++) {
+    if (! codec[i].inst) { copied = 1; continue; }
+    switch (codec[i].action) {
+      case modif: break;
+      case inlinefix:
+      case laterfix:  Scan.count = Scan.fix = 1; Scan.ok = copied; break;
+      case loop:      Scan.count = Scan.loop = 1; Scan.ok = copied && ! inloop; inloop = 1; break;
+      case endloop:   Scan.ok = inloop; inloop = 0; break;
+      case copyws:    Scan.ok = i + 2 < numc; i += 2; copied = 1; break;
+      default:        Scan.ok = 0; break;
+    }
+  }
+
+  if (inloop) { Scan.ok = 0; }                              // Loop without end.
+
+  return Scan;
+
+}
+
+static void emit(uint32_t t, te_t te, codec_t codec, uint32_t numc, uint32_t dec) {
+
+  Scan_t      Scan = scan(codec, numc);
+  CoI_t       CoI;
+  const char *ind = "  ";
+  uint32_t    i;
+  uint32_t    size;
+
+  printf("static uint32_t %s_%u_%u_%u(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {\n\n", dec ? "dec" : "enc", t, te->coistart, te->numcoi);
+  printf("  uint8_t * const       ds = d;\n");
+  printf("  const uint8_t * const de = d + dsz;\n");
+  printf("  const uint8_t * const se = s + ssz;\n");
+  if (! dec && Scan.fix) {
+    printf("  const uint8_t * const ss = s;\n");
+    printf("  const uint8_t *       f;\n");
+  }
+  if (! dec && Scan.count) {
+    printf("  const uint8_t *       b = s;                          // Before the skip of the last copy.\n");
+  }
+  if (Scan.loop) {
+    printf("  uint32_t              l;\n");
+  }
+  if (Scan.fix) {
+    printf("  uint32_t              c;\n");
+    printf("  uint32_t              n;\n");
+    printf("  Fix_t                 F[MAXFIX];\n");
+    printf("  uint32_t              nf = 0;\n");
+  }
+  printf("\n");
+
+  for (i = 0; i < numc; i++) {
+    CoI = codec[i];
+    if (! CoI.inst) {
+      printf("%s%s(%2u, %u);\n", ind, dec ? "DCOPY" : (Scan.count ? "ECOPYB" : "ECOPY"), CoI.num, CoI.skip);
+      continue;
+    }
+    switch (CoI.action) {
+      case modif: {
+        printf("%s// Modifier %u.\n", ind, CoI.arg);
+        break;
+      }
+      case inlinefix: {
+        printf("%s%s(%u);\n", ind, dec ? "DINLINE" : "EINLINE", CoI.arg);
+        break;
+      }
+      case laterfix: {
+        printf("%s%s(%u);\n", ind, dec ? "DLATER" : "ELATER", CoI.arg);
+        break;
+      }
+      case loop: {
+        printf("%sfor (l = %s[-1]; l; l--) {\n", ind, dec ? "s" : "b");
+        ind = "    ";
+        break;
+      }
+      case endloop: {
+        ind = "  ";
+        printf("%s}\n", ind);
+        break;
+      }
+      case copyws: {
+        size = (uint32_t) (codec[i + 2].MSB << 8) | codec[i + 1].LSB;
+        printf("%s%s(%u, %u);\n", ind, dec ? "DCOPY" : (Scan.count ? "ECOPYB" : "ECOPY"), size, CoI.arg);
+        i += 2;
+        break;
+      }
+    }
+  }
+
+  if (Scan.fix) {
+    if (dec) { printf("\n  d = fixdec(F, nf, d, de, s, se);\n"); }
+    else     { printf("\n  d = fixenc(F, nf, d, de);\n"); }
+    printf("  if (! d) { return 0; }\n");
+  }
+
+  printf("\n  return (uint32_t) (d - ds);\n\n}\n\n");
+
+}
+
+static void emitidx(void) {
+
+  uint32_t    t;
+  uint32_t    i;
+  uint32_t    num[NUM(ctabs)];
+  ctab_t      ctab;
+  te_t        te;
+
+  printf("// Copyright 2024 Steven Buytaert\n\n");
+  printf("// Generated direct index tables by hci-coi2c.c; do not edit.\n\n");
+  printf("#include <stddef.h>\n#include <codec-int.h>\n\n");
+  printf("// [event code or OCF][issub or isret] gives the table element index + 1; 0 when not there.\n\n");
+
+  for (t = 0; t < NUM(ctabs); t++) {
+    ctab = ctabs[t];
+    num[t] = 0;
+    if (! ctab->numtab) { continue; }
+    te = & ctab->table[ctab->numtab - 1];                   // Sorted, so the last has the highest code.
+    num[t] = (t ? te->OCF : te->code) + 1u;
+    printf("static const uint8_t Idx_%u[%u][2] = {\n", t, num[t]);
+    for (i = 0; i < ctab->numtab; i++) {
+      te = & ctab->table[i];
+      if (i + 1 < ctab->numtab && (t ? te->OCF == te[1].OCF : te->code == te[1].code)) {
+        printf("  [0x%02x] = { %3u, %3u },\n", t ? te->OCF : te->code, i + 1, i + 2);
+        i++;                                                // Both flavours; the 0 flag sorts first.
+      }
+      else {
+        printf("  [0x%02x][%u] = %3u,\n", t ? te->OCF : te->code, t ? te->isret : te->issub, i + 1);
+      }
+    }
+    printf("};\n\n");
+  }
+
+  printf("const CodecIdx_t cidx[%u] = {\n", (uint32_t) NUM(ctabs));
+  for (t = 0; t < NUM(ctabs); t++) {
+    if (num[t]) { printf("%s  { .num = %3u, .idx = Idx_%u }", t ? ",\n" : "", num[t], t); }
+    else        { printf("%s  { .num =   0, .idx = NULL }", t ? ",\n" : ""); }
+  }
+  printf("\n};\n");
+
+}
+
+int main(int argc, char * argv[]) {
+
+  uint32_t    bits = argc > 1 ? (uint32_t) atoi(argv[1]) : 64;
+  uint32_t    t;
+  uint32_t    i;
+  uint32_t    j;
+  ctab_t      ctab;
+  te_t        te;
+  te_t        first;
+
+  if (argc > 1 && ! strcmp("index", argv[1])) {
+    emitidx();
+    return 0;
+  }
+
+  if (32 != bits && 64 != bits) {
+    fprintf(stderr, "usage: %s [32|64|index] > hci-compiled-NN.c or hci-index.c\n", argv[0]);
+    return 1;
+  }
+
+  printf("// Copyright 2024 Steven Buytaert\n\n");
+  printf("// Generated codec functions from hci-tables-%u.c by hci-coi2c.c; do not edit.\n\n", bits);
+  printf("%s\n", preamble);
+  printf("_Static_assert(%u == sizeof(void *) * 8, \"Generated for a %u bit system.\");\n\n", bits, bits);
+
+  for (t = 0; t < NUM(ctabs); t++) {                        // The functions for each table ...
+    ctab = ctabs[t];
+    for (i = 0; i < ctab->numtab; i++) {
+      te = & ctab->table[i];
+      for (j = 0; j < i; j++) {                             // ... only once for the same instructions.
+        first = & ctab->table[j];
+        if (first->coistart == te->coistart && first->numcoi == te->numcoi) { break; }
+      }
+      if (j == i && scan(& ctab->CoI[te->coistart], te->numcoi).ok) {
+        emit(t, te, & ctab->CoI[te->coistart], te->numcoi, 1);
+        emit(t, te, & ctab->CoI[te->coistart], te->numcoi, 0);
+      }
+    }
+  }
+
+  for (t = 0; t < NUM(ctabs); t++) {                        // The dispatch table per codec table.
+    ctab = ctabs[t];
+    if (! ctab->numtab) { continue; }
+    printf("static const CodecFun_t CFun_%u[%u] = {\n", t, ctab->numtab);
+    for (i = 0; i < ctab->numtab; i++) {
+      te = & ctab->table[i];
+      if (scan(& ctab->CoI[te->coistart], te->numcoi).ok) {
+        printf("  { dec_%u_%u_%u, enc_%u_%u_%u },", t, te->coistart, te->numcoi, t, te->coistart, te->numcoi);
+      }
+      else {
+        printf("  { NULL, NULL },");                        // Interpreted.
+      }
+      if (t) { printf(" // %3u OCF 0x%02x %s\n", i, te->OCF, te->isret ? "ret" : "cmd"); }
+      else   { printf(" // %3u %s 0x%02x\n", i, te->issub ? "subevent" : "event", te->code); }
+    }
+    printf("};\n\n");
+  }
+
+  printf("const CodecFun_t * const cfuns[%u] = {\n", (uint32_t) NUM(ctabs));
+  for (t = 0; t < NUM(ctabs); t++) {
+    if (ctabs[t]->numtab) { printf("%s  CFun_%u", t ? ",\n" : "", t); }
+    else                  { printf("%s  NULL", t ? ",\n" : ""); }
+  }
+  printf("\n};\n");
+
+  return 0;
+
+}
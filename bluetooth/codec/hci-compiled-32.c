@@ -0,0 +1,8362 @@
+// Copyright 2024 Steven Buytaert
+
+// Generated codec functions from hci-tables-32.c by hci-coi2c.c; do not edit.
+
+#include <string.h>
+#include <codec-int.h>
+
+// On a problem, the functions return 0, so that the interpreter takes over and sets
+// the proper status. As the interpreter, they clear the padding bytes of a decoded
+// structure, unless NDEBUG is defined.
+
+#define MAXFIX 32                 // Same capacity as the interpreter.
+
+typedef struct Fix_t {
+  const uint8_t *       src;      // Inline data; NULL when the data comes after the fixed part.
+  void * *              ref;      // Where to write the destination pointer (decoding).
+  uint32_t              num;      // Number of bytes to copy.
+} Fix_t;
+
+#define FIX(SRC)                                            \
+  if (c) {                                                  \
+    if (MAXFIX - 1 == nf) { return 0; }                     \
+    F[nf].src = (SRC);                                      \
+    F[nf].ref = (void * *) d;                               \
+    F[nf].num = n;                                          \
+    nf++;                                                   \
+  }
+
+#if defined(NDEBUG)
+#define DPAD(SKIP)
+#else
+#define DPAD(SKIP) memset(d, 0x00, SKIP)
+#endif
+
+#define DCOPY(N, SKIP)                                      \
+  if (s + (N) > se || d + (N) >= de) { return 0; }          \
+  if (d + (N) + (SKIP) > de) { return 0; }                  \
+  memcpy(d, s, N); d += (N); DPAD(SKIP); d += (SKIP); s += (N);
+
+#define DINLINE(ARG)                                        \
+  c = s[-1]; n = c * (ARG);                                 \
+  if (s + n > se || d + sizeof(void *) >= de) { return 0; } \
+  memset(d, 0x00, sizeof(void *));                          \
+  FIX(s);                                                   \
+  d += sizeof(void *); s += n;
+
+#define DLATER(ARG)                                         \
+  c = s[-1]; n = c * (ARG);                                 \
+  if (d + sizeof(void *) >= de) { return 0; }               \
+  memset(d, 0x00, sizeof(void *));                          \
+  FIX(NULL);                                                \
+  d += sizeof(void *);
+
+#define ECOPY(N, SKIP)                                      \
+  if (s + (N) > se || d + (N) >= de) { return 0; }          \
+  memcpy(d, s, N); d += (N); s += (N) + (SKIP);
+
+#define ECOPYB(N, SKIP)                                     \
+  if (s + (N) > se || d + (N) >= de) { return 0; }          \
+  memcpy(d, s, N); d += (N); s += (N); b = s; s += (SKIP);
+
+#define EFROM(ARG)                                          \
+  if (s + sizeof(void *) > se) { return 0; }                \
+  c = b[-1]; n = c * (ARG);                                 \
+  memcpy(& f, s, sizeof(f));                                \
+  if (n && (! f || f + n > se || f < ss)) { return 0; }     \
+  s += sizeof(void *);
+
+#define EINLINE(ARG)                                        \
+  EFROM(ARG);                                               \
+  if (d + n >= de) { return 0; }                            \
+  if (n) { memcpy(d, f, n); }                               \
+  d += n;
+
+#define ELATER(ARG)                                         \
+  EFROM(ARG);                                               \
+  FIX(f);
+
+static uint8_t * fixdec(Fix_t F[], uint32_t nf, uint8_t * d, const uint8_t * de, const uint8_t * s, const uint8_t * se) {
+
+  for (uint32_t i = 0; i < nf; i++) {
+    if (d + F[i].num >= de) { return NULL; }
+    if (F[i].src) {                                         // Data was inline.
+      memcpy(d, F[i].src, F[i].num);
+    }
+    else {                                                  // Data follows the fixed part.
+      if (s + F[i].num > se) { return NULL; }
+      memcpy(d, s, F[i].num);
+      s += F[i].num;
+    }
+    memcpy(F[i].ref, & d, sizeof(d));                       // The structure may be packed.
+    d += F[i].num;
+  }
+
+  return d;
+
+}
+
+static uint8_t * fixenc(Fix_t F[], uint32_t nf, uint8_t * d, const uint8_t * de) {
+
+  for (uint32_t i = 0; i < nf; i++) {
+    if (d + F[i].num >= de) { return NULL; }
+    if (F[i].num) { memcpy(d, F[i].src, F[i].num); }
+    d += F[i].num;
+  }
+
+  return d;
+
+}
+
+_Static_assert(32 == sizeof(void *) * 8, "Generated for a 32 bit system.");
+
+static uint32_t dec_0_13_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 4, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_13_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 4, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_66_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 5, 1);
+  DCOPY(17, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_66_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 5, 1);
+  ECOPY(17, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_33_6(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  uint32_t              l;
+
+  DCOPY( 4, 0);
+  for (l = s[-1]; l; l--) {
+    DCOPY( 7, 1);
+    DCOPY( 5, 1);
+    DCOPY( 2, 0);
+  }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_33_6(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  const uint8_t *       b = s;                          // Before the skip of the last copy.
+  uint32_t              l;
+
+  ECOPYB( 4, 0);
+  for (l = b[-1]; l; l--) {
+    ECOPYB( 7, 1);
+    ECOPYB( 5, 1);
+    ECOPYB( 2, 0);
+  }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_46_6(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  uint32_t              l;
+  uint32_t              c;
+  uint32_t              n;
+  Fix_t                 F[MAXFIX];
+  uint32_t              nf = 0;
+
+  DCOPY( 5, 3);
+  for (l = s[-1]; l; l--) {
+    DCOPY( 9, 3);
+    DINLINE(1);
+    DCOPY( 1, 3);
+  }
+
+  d = fixdec(F, nf, d, de, s, se);
+  if (! d) { return 0; }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_46_6(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  const uint8_t * const ss = s;
+  const uint8_t *       f;
+  const uint8_t *       b = s;                          // Before the skip of the last copy.
+  uint32_t              l;
+  uint32_t              c;
+  uint32_t              n;
+  Fix_t                 F[MAXFIX];
+  uint32_t              nf = 0;
+
+  ECOPYB( 5, 3);
+  for (l = b[-1]; l; l--) {
+    ECOPYB( 9, 3);
+    EINLINE(1);
+    ECOPYB( 1, 3);
+  }
+
+  d = fixenc(F, nf, d, de);
+  if (! d) { return 0; }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_8_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 3, 1);
+  DCOPY( 1, 1);
+  DCOPY(10, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_8_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 3, 1);
+  ECOPY( 1, 1);
+  ECOPY(10, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_74_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 5, 1);
+  DCOPY( 8, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_74_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 5, 1);
+  ECOPY( 8, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_14_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY(13, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_14_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY(13, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_135_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 5, 1);
+  DCOPY(10, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_135_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 5, 1);
+  ECOPY(10, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_18_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 3, 1);
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_18_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 3, 1);
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_29_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY(16, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_29_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY(16, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_3_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 3, 1);
+  DCOPY( 1, 1);
+  DCOPY( 2, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_3_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 3, 1);
+  ECOPY( 1, 1);
+  ECOPY( 2, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_87_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY(14, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_87_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY(14, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_178_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY(257, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_178_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY(257, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_132_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY(69, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_132_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY(69, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_107_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY(37, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_107_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY(37, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_98_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 5, 1);
+  DCOPY(29, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_98_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 5, 1);
+  ECOPY(29, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_88_6(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  uint32_t              l;
+
+  DCOPY( 5, 0);
+  for (l = s[-1]; l; l--) {
+    DCOPY(16, 0);
+  }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_88_6(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  const uint8_t *       b = s;                          // Before the skip of the last copy.
+  uint32_t              l;
+
+  ECOPYB( 5, 0);
+  for (l = b[-1]; l; l--) {
+    ECOPYB(16, 0);
+  }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_171_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 3, 1);
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 4, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_171_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 3, 1);
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY( 4, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_130_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 5, 1);
+  DCOPY( 4, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_130_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 5, 1);
+  ECOPY( 4, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_162_6(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 3, 1);
+  DCOPY( 1, 1);
+  DCOPY( 4, 2);
+  DCOPY(16, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_162_6(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 3, 1);
+  ECOPY( 1, 1);
+  ECOPY( 4, 2);
+  ECOPY(16, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_102_5(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  uint32_t              l;
+  uint32_t              c;
+  uint32_t              n;
+  Fix_t                 F[MAXFIX];
+  uint32_t              nf = 0;
+
+  DCOPY( 5, 3);
+  for (l = s[-1]; l; l--) {
+    DCOPY( 8, 0);
+    DINLINE(1);
+  }
+
+  d = fixdec(F, nf, d, de, s, se);
+  if (! d) { return 0; }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_102_5(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  const uint8_t * const ss = s;
+  const uint8_t *       f;
+  const uint8_t *       b = s;                          // Before the skip of the last copy.
+  uint32_t              l;
+  uint32_t              c;
+  uint32_t              n;
+  Fix_t                 F[MAXFIX];
+  uint32_t              nf = 0;
+
+  ECOPYB( 5, 3);
+  for (l = b[-1]; l; l--) {
+    ECOPYB( 8, 0);
+    EINLINE(1);
+  }
+
+  d = fixenc(F, nf, d, de);
+  if (! d) { return 0; }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_0_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 6, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_0_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 6, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_121_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 5, 1);
+  DCOPY(11, 1);
+  DCOPY( 3, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_121_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 5, 1);
+  ECOPY(11, 1);
+  ECOPY( 3, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_6_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 5, 1);
+  DCOPY( 2, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_6_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 5, 1);
+  ECOPY( 2, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_16_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  uint32_t              c;
+  uint32_t              n;
+  Fix_t                 F[MAXFIX];
+  uint32_t              nf = 0;
+
+  DCOPY(11, 0);
+  DINLINE(0);
+
+  d = fixdec(F, nf, d, de, s, se);
+  if (! d) { return 0; }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_16_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  const uint8_t * const ss = s;
+  const uint8_t *       f;
+  const uint8_t *       b = s;                          // Before the skip of the last copy.
+  uint32_t              c;
+  uint32_t              n;
+  Fix_t                 F[MAXFIX];
+  uint32_t              nf = 0;
+
+  ECOPYB(11, 0);
+  EINLINE(0);
+
+  d = fixenc(F, nf, d, de);
+  if (! d) { return 0; }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_57_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 6, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_57_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 6, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_1_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 3, 1);
+  DCOPY( 2, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_1_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 3, 1);
+  ECOPY( 2, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_10_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY(10, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_10_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY(10, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_52_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 9, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_52_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 9, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_158_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  uint32_t              l;
+
+  DCOPY( 4, 0);
+  for (l = s[-1]; l; l--) {
+    DCOPY( 4, 0);
+  }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_158_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  const uint8_t *       b = s;                          // Before the skip of the last copy.
+  uint32_t              l;
+
+  ECOPYB( 4, 0);
+  for (l = b[-1]; l; l--) {
+    ECOPYB( 4, 0);
+  }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_45_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY(12, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_45_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY(12, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_149_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 3, 1);
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 2, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_149_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 3, 1);
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY( 2, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_35_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 7, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_35_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 7, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_181_6(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  uint32_t              l;
+
+  DCOPY( 4, 0);
+  for (l = s[-1]; l; l--) {
+    DCOPY(22, 0);
+  }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_181_6(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  const uint8_t *       b = s;                          // Before the skip of the last copy.
+  uint32_t              l;
+
+  ECOPYB( 4, 0);
+  for (l = b[-1]; l; l--) {
+    ECOPYB(22, 0);
+  }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_76_5(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  uint32_t              l;
+
+  DCOPY( 7, 1);
+  DCOPY( 9, 0);
+  for (l = s[-1]; l; l--) {
+    DCOPY( 2, 0);
+  }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_76_5(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  const uint8_t *       b = s;                          // Before the skip of the last copy.
+  uint32_t              l;
+
+  ECOPYB( 7, 1);
+  ECOPYB( 9, 0);
+  for (l = b[-1]; l; l--) {
+    ECOPYB( 2, 0);
+  }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_44_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 9, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_44_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 9, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_70_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  uint32_t              l;
+
+  DCOPY( 1, 0);
+  for (l = s[-1]; l; l--) {
+    DCOPY( 2, 0);
+  }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_70_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  const uint8_t *       b = s;                          // Before the skip of the last copy.
+  uint32_t              l;
+
+  ECOPYB( 1, 0);
+  for (l = b[-1]; l; l--) {
+    ECOPYB( 2, 0);
+  }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_141_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY(26, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_141_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY(26, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_127_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 5, 1);
+  DCOPY(15, 1);
+  DCOPY( 3, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_127_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 5, 1);
+  ECOPY(15, 1);
+  ECOPY( 3, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_146_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 3, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_146_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 3, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_61_5(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 5, 1);
+  DCOPY(21, 1);
+  DCOPY( 6, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_61_5(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 5, 1);
+  ECOPY(21, 1);
+  ECOPY( 6, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_147_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 3, 1);
+  DCOPY( 3, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_147_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 3, 1);
+  ECOPY( 3, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_81_6(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  uint32_t              c;
+  uint32_t              n;
+  Fix_t                 F[MAXFIX];
+  uint32_t              nf = 0;
+
+  DCOPY(17, 1);
+  DCOPY( 5, 1);
+  DINLINE(0);
+  DCOPY( 2, 0);
+
+  d = fixdec(F, nf, d, de, s, se);
+  if (! d) { return 0; }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_81_6(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  const uint8_t * const ss = s;
+  const uint8_t *       f;
+  const uint8_t *       b = s;                          // Before the skip of the last copy.
+  uint32_t              c;
+  uint32_t              n;
+  Fix_t                 F[MAXFIX];
+  uint32_t              nf = 0;
+
+  ECOPYB(17, 1);
+  ECOPYB( 5, 1);
+  EINLINE(0);
+  ECOPYB( 2, 0);
+
+  d = fixenc(F, nf, d, de);
+  if (! d) { return 0; }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_11_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 3, 1);
+  DCOPY( 1, 1);
+  DCOPY( 4, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_11_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 3, 1);
+  ECOPY( 1, 1);
+  ECOPY( 4, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_53_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  uint32_t              c;
+  uint32_t              n;
+  Fix_t                 F[MAXFIX];
+  uint32_t              nf = 0;
+
+  DCOPY(13, 1);
+  DCOPY( 5, 1);
+  DINLINE(0);
+  DCOPY( 2, 0);
+
+  d = fixdec(F, nf, d, de, s, se);
+  if (! d) { return 0; }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_53_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  const uint8_t * const ss = s;
+  const uint8_t *       f;
+  const uint8_t *       b = s;                          // Before the skip of the last copy.
+  uint32_t              c;
+  uint32_t              n;
+  Fix_t                 F[MAXFIX];
+  uint32_t              nf = 0;
+
+  ECOPYB(13, 1);
+  ECOPYB( 5, 1);
+  EINLINE(0);
+  ECOPYB( 2, 0);
+
+  d = fixenc(F, nf, d, de);
+  if (! d) { return 0; }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_137_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 5, 1);
+  DCOPY( 3, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_137_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 5, 1);
+  ECOPY( 3, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_75_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 8, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_75_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 8, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_25_7(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 3, 1);
+  DCOPY( 1, 1);
+  DCOPY( 3, 3);
+  DCOPY( 2, 2);
+  DCOPY(16, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_25_7(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 3, 1);
+  ECOPY( 1, 1);
+  ECOPY( 3, 3);
+  ECOPY( 2, 2);
+  ECOPY(16, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_139_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 5, 1);
+  DCOPY( 7, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_139_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 5, 1);
+  ECOPY( 7, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_39_5(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  uint32_t              l;
+
+  DCOPY( 4, 0);
+  for (l = s[-1]; l; l--) {
+    DCOPY(11, 1);
+    DCOPY( 3, 1);
+  }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_39_5(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  const uint8_t *       b = s;                          // Before the skip of the last copy.
+  uint32_t              l;
+
+  ECOPYB( 4, 0);
+  for (l = b[-1]; l; l--) {
+    ECOPYB(11, 1);
+    ECOPYB( 3, 1);
+  }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_58_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY(13, 1);
+  DCOPY( 5, 1);
+  DCOPY( 5, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_58_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY(13, 1);
+  ECOPY( 5, 1);
+  ECOPY( 5, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_168_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 3, 1);
+  DCOPY( 1, 1);
+  DCOPY(12, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_168_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 3, 1);
+  ECOPY( 1, 1);
+  ECOPY(12, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_118_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 5, 1);
+  DCOPY(11, 1);
+  DCOPY( 7, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_118_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 5, 1);
+  ECOPY(11, 1);
+  ECOPY( 7, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_110_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  uint32_t              c;
+  uint32_t              n;
+  Fix_t                 F[MAXFIX];
+  uint32_t              nf = 0;
+
+  DCOPY( 9, 1);
+  DCOPY( 5, 0);
+  DINLINE(0);
+
+  d = fixdec(F, nf, d, de, s, se);
+  if (! d) { return 0; }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_110_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  const uint8_t * const ss = s;
+  const uint8_t *       f;
+  const uint8_t *       b = s;                          // Before the skip of the last copy.
+  uint32_t              c;
+  uint32_t              n;
+  Fix_t                 F[MAXFIX];
+  uint32_t              nf = 0;
+
+  ECOPYB( 9, 1);
+  ECOPYB( 5, 0);
+  EINLINE(0);
+
+  d = fixenc(F, nf, d, de);
+  if (! d) { return 0; }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_124_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 5, 1);
+  DCOPY(15, 1);
+  DCOPY( 7, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_124_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 5, 1);
+  ECOPY(15, 1);
+  ECOPY( 7, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_32_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 7, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_32_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 7, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_113_5(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  uint32_t              l;
+  uint32_t              c;
+  uint32_t              n;
+  Fix_t                 F[MAXFIX];
+  uint32_t              nf = 0;
+
+  DCOPY( 8, 0);
+  for (l = s[-1]; l; l--) {
+    DCOPY( 6, 2);
+    DINLINE(1);
+  }
+
+  d = fixdec(F, nf, d, de, s, se);
+  if (! d) { return 0; }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_113_5(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  const uint8_t * const ss = s;
+  const uint8_t *       f;
+  const uint8_t *       b = s;                          // Before the skip of the last copy.
+  uint32_t              l;
+  uint32_t              c;
+  uint32_t              n;
+  Fix_t                 F[MAXFIX];
+  uint32_t              nf = 0;
+
+  ECOPYB( 8, 0);
+  for (l = b[-1]; l; l--) {
+    ECOPYB( 6, 2);
+    EINLINE(1);
+  }
+
+  d = fixenc(F, nf, d, de);
+  if (! d) { return 0; }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_94_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 5, 1);
+  DCOPY(32, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_94_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 5, 1);
+  ECOPY(32, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_195_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 3, 1);
+  DCOPY( 1, 1);
+  DCOPY(11, 1);
+  DCOPY( 5, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_195_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 3, 1);
+  ECOPY( 1, 1);
+  ECOPY(11, 1);
+  ECOPY( 5, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_192_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 3, 1);
+  DCOPY( 1, 1);
+  DCOPY( 8, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_192_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 3, 1);
+  ECOPY( 1, 1);
+  ECOPY( 8, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_21_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY(15, 1);
+  DCOPY(243, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_21_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY(15, 1);
+  ECOPY(243, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_202_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 9, 3);
+  DCOPY( 4, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_202_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 9, 3);
+  ECOPY( 4, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_144_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 3, 1);
+  DCOPY( 4, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_144_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 3, 1);
+  ECOPY( 4, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_175_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY(17, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_175_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY(17, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_153_5(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  uint32_t              l;
+
+  DCOPY( 3, 1);
+  DCOPY( 3, 1);
+  for (l = s[-1]; l; l--) {
+    DCOPY( 6, 0);
+  }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_153_5(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  const uint8_t *       b = s;                          // Before the skip of the last copy.
+  uint32_t              l;
+
+  ECOPYB( 3, 1);
+  ECOPYB( 3, 1);
+  for (l = b[-1]; l; l--) {
+    ECOPYB( 6, 0);
+  }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_199_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 3, 1);
+  DCOPY( 3, 1);
+  DCOPY( 6, 2);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_199_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 3, 1);
+  ECOPY( 3, 1);
+  ECOPY( 6, 2);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_189_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 9, 2);
+  DCOPY(15, 1);
+  DCOPY( 7, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_189_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 9, 2);
+  ECOPY(15, 1);
+  ECOPY( 7, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_15_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  uint32_t              c;
+  uint32_t              n;
+  Fix_t                 F[MAXFIX];
+  uint32_t              nf = 0;
+
+  DCOPY(10, 2);
+  DCOPY(11, 0);
+  DINLINE(0);
+
+  d = fixdec(F, nf, d, de, s, se);
+  if (! d) { return 0; }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_15_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  const uint8_t * const ss = s;
+  const uint8_t *       f;
+  const uint8_t *       b = s;                          // Before the skip of the last copy.
+  uint32_t              c;
+  uint32_t              n;
+  Fix_t                 F[MAXFIX];
+  uint32_t              nf = 0;
+
+  ECOPYB(10, 2);
+  ECOPYB(11, 0);
+  EINLINE(0);
+
+  d = fixenc(F, nf, d, de);
+  if (! d) { return 0; }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_0_187_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 3, 1);
+  DCOPY( 8, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_0_187_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 3, 1);
+  ECOPY( 8, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_1_41_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 5, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_1_41_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY( 5, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_1_3_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_1_3_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_1_2_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 7, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_1_2_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 7, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_1_47_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 9, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_1_47_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY( 9, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_1_19_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY(13, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_1_19_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY(13, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_1_22_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 3, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_1_22_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY( 3, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_1_15_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 6, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_1_15_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY( 6, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_1_18_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY(13, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_1_18_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY(13, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_1_0_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 7, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_1_0_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY( 7, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_1_44_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 7, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_1_44_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY( 7, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_1_50_5(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY(22, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_1_50_5(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY(22, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_1_58_5(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY(23, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_1_58_5(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY(23, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_1_12_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 4, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_1_12_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY( 4, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_1_9_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 2, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_1_9_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY( 2, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_1_55_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 1, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_1_55_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY( 1, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_1_69_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY(10, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_1_69_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY(10, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_1_63_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 7, 1);
+  DCOPY( 3, 1);
+  DCOPY( 4, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_1_63_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 7, 1);
+  ECOPY( 3, 1);
+  ECOPY( 4, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_1_91_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY(15, 1);
+  DCOPY( 2, 2);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_1_91_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY(15, 1);
+  ECOPY( 2, 2);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_1_3_6(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY(19, 1);
+  DCOPY( 2, 2);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_1_3_6(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY(19, 1);
+  ECOPY( 2, 2);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_1_99_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY(10, 2);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_1_99_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY(10, 2);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_1_72_5(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY(38, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_1_72_5(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY(38, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_1_33_8(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY(24, 2);
+  DCOPY(35, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_1_33_8(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY(24, 2);
+  ECOPY(35, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_1_25_8(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY(28, 2);
+  DCOPY(35, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_1_25_8(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY(28, 2);
+  ECOPY(35, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_1_95_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 7, 1);
+  DCOPY( 2, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_1_95_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY( 7, 1);
+  ECOPY( 2, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_1_82_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 3, 1);
+  DCOPY( 8, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_1_82_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY( 3, 1);
+  ECOPY( 8, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_1_71_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY(10, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_1_71_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY(10, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_1_86_5(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY(34, 2);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_1_86_5(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY(34, 2);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_1_66_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY(12, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_1_66_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY(12, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_1_77_5(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY(70, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_1_77_5(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY(70, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_2_10_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 6, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_2_10_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY( 6, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_2_28_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY(10, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_2_28_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY(10, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_2_0_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 2, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_2_0_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY( 2, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_2_13_6(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 4, 2);
+  DCOPY(16, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_2_13_6(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY( 4, 2);
+  ECOPY(16, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_2_21_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 2, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_2_21_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY( 2, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_2_26_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 7, 1);
+  DCOPY( 3, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_2_26_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 7, 1);
+  ECOPY( 3, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_2_34_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 7, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_2_34_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY( 7, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_2_24_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 7, 1);
+  DCOPY( 4, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_2_24_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 7, 1);
+  ECOPY( 4, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_2_37_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 4, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_2_37_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY( 4, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_2_19_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 7, 1);
+  DCOPY( 2, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_2_19_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 7, 1);
+  ECOPY( 2, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_2_3_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_2_3_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_2_19_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 7, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_2_19_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 7, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_2_3_7(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 3, 3);
+  DCOPY( 2, 2);
+  DCOPY(16, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_2_3_7(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY( 3, 3);
+  ECOPY( 2, 2);
+  ECOPY(16, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_2_31_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 8, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_2_31_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY( 8, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_3_64_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 8, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_3_64_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY( 8, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_3_4_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 7, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_3_4_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 7, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_3_5_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_3_5_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_3_17_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 2, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_3_17_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY( 2, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_3_12_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 7, 1);
+  DCOPY( 2, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_3_12_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 7, 1);
+  ECOPY( 2, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_3_8_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 8, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_3_8_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 8, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_3_5_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 1, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_3_5_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY( 1, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_3_9_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 7, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_3_9_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY( 7, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_3_30_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 7, 1);
+  DCOPY( 4, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_3_30_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 7, 1);
+  ECOPY( 4, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_3_110_8(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  uint32_t              l;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 1, 0);
+  for (l = s[-1]; l; l--) {
+    DCOPY(22, 0);
+  }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_3_110_8(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  const uint8_t *       b = s;                          // Before the skip of the last copy.
+  uint32_t              l;
+
+  ECOPYB( 1, 1);
+  ECOPYB( 3, 1);
+  ECOPYB( 1, 0);
+  for (l = b[-1]; l; l--) {
+    ECOPYB(22, 0);
+  }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_3_105_5(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY(248, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_3_105_5(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY(248, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_3_42_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY(255, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_3_42_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY(255, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_3_92_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 4, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_3_92_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY( 4, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_3_32_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY(10, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_3_32_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY(10, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_3_14_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 3, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_3_14_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY( 3, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_3_54_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 7, 1);
+  DCOPY( 3, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_3_54_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 7, 1);
+  ECOPY( 3, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_3_20_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 3, 1);
+  DCOPY( 4, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_3_20_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY( 3, 1);
+  ECOPY( 4, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_3_24_6(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  uint32_t              l;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 1, 1);
+  for (l = s[-1]; l; l--) {
+    DCOPY( 4, 0);
+  }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_3_24_6(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  const uint8_t *       b = s;                          // Before the skip of the last copy.
+  uint32_t              l;
+
+  ECOPYB( 1, 1);
+  ECOPYB( 3, 1);
+  ECOPYB( 1, 1);
+  for (l = b[-1]; l; l--) {
+    ECOPYB( 4, 0);
+  }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_3_33_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  uint32_t              c;
+  uint32_t              n;
+  Fix_t                 F[MAXFIX];
+  uint32_t              nf = 0;
+
+  DCOPY( 8, 0);
+  DINLINE(0);
+  DCOPY( 3, 1);
+
+  d = fixdec(F, nf, d, de, s, se);
+  if (! d) { return 0; }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_3_33_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  const uint8_t * const ss = s;
+  const uint8_t *       f;
+  const uint8_t *       b = s;                          // Before the skip of the last copy.
+  uint32_t              c;
+  uint32_t              n;
+  Fix_t                 F[MAXFIX];
+  uint32_t              nf = 0;
+
+  ECOPYB( 8, 0);
+  EINLINE(0);
+  ECOPYB( 3, 1);
+
+  d = fixenc(F, nf, d, de);
+  if (! d) { return 0; }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_3_95_5(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  uint32_t              c;
+  uint32_t              n;
+  Fix_t                 F[MAXFIX];
+  uint32_t              nf = 0;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 1, 0);
+  DINLINE(0);
+  DCOPY( 3, 1);
+
+  d = fixdec(F, nf, d, de, s, se);
+  if (! d) { return 0; }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_3_95_5(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  const uint8_t * const ss = s;
+  const uint8_t *       f;
+  const uint8_t *       b = s;                          // Before the skip of the last copy.
+  uint32_t              c;
+  uint32_t              n;
+  Fix_t                 F[MAXFIX];
+  uint32_t              nf = 0;
+
+  ECOPYB( 1, 1);
+  ECOPYB( 3, 1);
+  ECOPYB( 1, 0);
+  EINLINE(0);
+  ECOPYB( 3, 1);
+
+  d = fixenc(F, nf, d, de);
+  if (! d) { return 0; }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_3_57_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY(10, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_3_57_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY(10, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_3_38_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY(248, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_3_38_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY(248, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_3_100_5(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY(241, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_3_100_5(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY(241, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_3_45_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY(39, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_3_45_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY(39, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_3_56_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY(13, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_3_56_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY(13, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_3_36_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 7, 1);
+  DCOPY( 5, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_3_36_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 7, 1);
+  ECOPY( 5, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_3_41_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 9, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_3_41_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 9, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_3_73_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 1, 1);
+  DCOPY( 9, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_3_73_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY( 1, 1);
+  ECOPY( 9, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_3_67_6(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  uint32_t              l;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 7, 1);
+  for (l = s[-1]; l; l--) {
+    DCOPY( 3, 1);
+  }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_3_67_6(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  const uint8_t *       b = s;                          // Before the skip of the last copy.
+  uint32_t              l;
+
+  ECOPYB( 1, 1);
+  ECOPYB( 3, 1);
+  ECOPYB( 7, 1);
+  for (l = b[-1]; l; l--) {
+    ECOPYB( 3, 1);
+  }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_3_77_5(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY(30, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_3_77_5(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY(30, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_3_82_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 7, 1);
+  DCOPY(32, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_3_82_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 7, 1);
+  ECOPY(32, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_3_5_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 1, 1);
+  DCOPY( 8, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_3_5_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY( 1, 1);
+  ECOPY( 8, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_3_86_6(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  uint32_t              l;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 2, 0);
+  for (l = s[-1]; l; l--) {
+    DCOPY( 1, 1);
+  }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_3_86_6(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  const uint8_t *       b = s;                          // Before the skip of the last copy.
+  uint32_t              l;
+
+  ECOPYB( 1, 1);
+  ECOPYB( 3, 1);
+  ECOPYB( 2, 0);
+  for (l = b[-1]; l; l--) {
+    ECOPYB( 1, 1);
+  }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_3_60_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  uint32_t              c;
+  uint32_t              n;
+  Fix_t                 F[MAXFIX];
+  uint32_t              nf = 0;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 3, 0);
+  DINLINE(0);
+
+  d = fixdec(F, nf, d, de, s, se);
+  if (! d) { return 0; }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_3_60_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  const uint8_t * const ss = s;
+  const uint8_t *       f;
+  const uint8_t *       b = s;                          // Before the skip of the last copy.
+  uint32_t              c;
+  uint32_t              n;
+  Fix_t                 F[MAXFIX];
+  uint32_t              nf = 0;
+
+  ECOPYB( 1, 1);
+  ECOPYB( 3, 1);
+  ECOPYB( 3, 0);
+  EINLINE(0);
+
+  d = fixenc(F, nf, d, de);
+  if (! d) { return 0; }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_3_51_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 7, 1);
+  DCOPY( 2, 2);
+  DCOPY( 5, 3);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_3_51_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 7, 1);
+  ECOPY( 2, 2);
+  ECOPY( 5, 3);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_3_118_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 4, 2);
+  DCOPY( 5, 3);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_3_118_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY( 4, 2);
+  ECOPY( 5, 3);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_3_48_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY(71, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_3_48_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY(71, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_3_0_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  uint32_t              c;
+  uint32_t              n;
+  Fix_t                 F[MAXFIX];
+  uint32_t              nf = 0;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 3, 0);
+  DINLINE(0);
+
+  d = fixdec(F, nf, d, de, s, se);
+  if (! d) { return 0; }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_3_0_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  const uint8_t * const ss = s;
+  const uint8_t *       f;
+  const uint8_t *       b = s;                          // Before the skip of the last copy.
+  uint32_t              c;
+  uint32_t              n;
+  Fix_t                 F[MAXFIX];
+  uint32_t              nf = 0;
+
+  ECOPYB( 1, 1);
+  ECOPYB( 3, 1);
+  ECOPYB( 3, 0);
+  EINLINE(0);
+
+  d = fixenc(F, nf, d, de);
+  if (! d) { return 0; }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_4_3_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_4_3_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_4_36_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY(11, 1);
+  DCOPY( 4, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_4_36_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY(11, 1);
+  ECOPY( 4, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_4_28_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY(71, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_4_28_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY(71, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_4_35_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY(15, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_4_35_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY(15, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_4_10_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 1, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_4_10_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY( 1, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_4_13_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY(17, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_4_13_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY(17, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_4_5_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 7, 1);
+  DCOPY( 3, 1);
+  DCOPY( 4, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_4_5_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 7, 1);
+  ECOPY( 3, 1);
+  ECOPY( 4, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_4_0_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_4_0_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_4_2_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY(13, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_4_2_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY(13, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_4_8_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 7, 1);
+  DCOPY( 6, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_4_8_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 7, 1);
+  ECOPY( 6, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_4_25_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  uint32_t              c;
+  uint32_t              n;
+  Fix_t                 F[MAXFIX];
+  uint32_t              nf = 0;
+
+  DCOPY( 8, 0);
+  DINLINE(1);
+  DCOPY( 2, 2);
+
+  d = fixdec(F, nf, d, de, s, se);
+  if (! d) { return 0; }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_4_25_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  const uint8_t * const ss = s;
+  const uint8_t *       f;
+  const uint8_t *       b = s;                          // Before the skip of the last copy.
+  uint32_t              c;
+  uint32_t              n;
+  Fix_t                 F[MAXFIX];
+  uint32_t              nf = 0;
+
+  ECOPYB( 8, 0);
+  EINLINE(1);
+  ECOPYB( 2, 2);
+
+  d = fixenc(F, nf, d, de);
+  if (! d) { return 0; }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_4_16_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 9, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_4_16_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 9, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_4_22_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  uint32_t              c;
+  uint32_t              n;
+  Fix_t                 F[MAXFIX];
+  uint32_t              nf = 0;
+
+  DCOPY( 8, 0);
+  DLATER(2);
+  DCOPY( 1, 3);
+
+  d = fixdec(F, nf, d, de, s, se);
+  if (! d) { return 0; }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_4_22_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  const uint8_t * const ss = s;
+  const uint8_t *       f;
+  const uint8_t *       b = s;                          // Before the skip of the last copy.
+  uint32_t              c;
+  uint32_t              n;
+  Fix_t                 F[MAXFIX];
+  uint32_t              nf = 0;
+
+  ECOPYB( 8, 0);
+  ELATER(2);
+  ECOPYB( 1, 3);
+
+  d = fixenc(F, nf, d, de);
+  if (! d) { return 0; }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_4_3_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 7, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_4_3_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY( 7, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_4_17_5(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  uint32_t              l;
+  uint32_t              c;
+  uint32_t              n;
+  Fix_t                 F[MAXFIX];
+  uint32_t              nf = 0;
+
+  DCOPY( 8, 0);
+  for (l = s[-1]; l; l--) {
+    DCOPY( 1, 3);
+    DINLINE(1);
+  }
+
+  d = fixdec(F, nf, d, de, s, se);
+  if (! d) { return 0; }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_4_17_5(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  const uint8_t * const ss = s;
+  const uint8_t *       f;
+  const uint8_t *       b = s;                          // Before the skip of the last copy.
+  uint32_t              l;
+  uint32_t              c;
+  uint32_t              n;
+  Fix_t                 F[MAXFIX];
+  uint32_t              nf = 0;
+
+  ECOPYB( 8, 0);
+  for (l = b[-1]; l; l--) {
+    ECOPYB( 1, 3);
+    EINLINE(1);
+  }
+
+  d = fixenc(F, nf, d, de);
+  if (! d) { return 0; }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_4_31_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  uint32_t              c;
+  uint32_t              n;
+  Fix_t                 F[MAXFIX];
+  uint32_t              nf = 0;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 8, 0);
+  DINLINE(0);
+
+  d = fixdec(F, nf, d, de, s, se);
+  if (! d) { return 0; }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_4_31_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  const uint8_t * const ss = s;
+  const uint8_t *       f;
+  const uint8_t *       b = s;                          // Before the skip of the last copy.
+  uint32_t              c;
+  uint32_t              n;
+  Fix_t                 F[MAXFIX];
+  uint32_t              nf = 0;
+
+  ECOPYB( 1, 1);
+  ECOPYB( 3, 1);
+  ECOPYB( 8, 0);
+  EINLINE(0);
+
+  d = fixenc(F, nf, d, de);
+  if (! d) { return 0; }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_5_7_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 2, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_5_7_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY( 2, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_5_17_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 7, 1);
+  DCOPY( 4, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_5_17_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 7, 1);
+  ECOPY( 4, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_5_19_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 7, 1);
+  DCOPY( 2, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_5_19_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 7, 1);
+  ECOPY( 2, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_5_15_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 7, 1);
+  DCOPY( 3, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_5_15_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 7, 1);
+  ECOPY( 3, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_5_10_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 7, 1);
+  DCOPY(13, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_5_10_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 7, 1);
+  ECOPY(13, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_5_12_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 7, 1);
+  DCOPY( 2, 2);
+  DCOPY( 6, 2);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_5_12_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 7, 1);
+  ECOPY( 2, 2);
+  ECOPY( 6, 2);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_5_0_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_5_0_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_5_2_5(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  uint32_t              l;
+  uint32_t              c;
+  uint32_t              n;
+  Fix_t                 F[MAXFIX];
+  uint32_t              nf = 0;
+
+  DCOPY( 8, 0);
+  for (l = s[-1]; l; l--) {
+    DCOPY( 2, 2);
+    DLATER(8);
+  }
+
+  d = fixdec(F, nf, d, de, s, se);
+  if (! d) { return 0; }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_5_2_5(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  const uint8_t * const ss = s;
+  const uint8_t *       f;
+  const uint8_t *       b = s;                          // Before the skip of the last copy.
+  uint32_t              l;
+  uint32_t              c;
+  uint32_t              n;
+  Fix_t                 F[MAXFIX];
+  uint32_t              nf = 0;
+
+  ECOPYB( 8, 0);
+  for (l = b[-1]; l; l--) {
+    ECOPYB( 2, 2);
+    ELATER(8);
+  }
+
+  d = fixenc(F, nf, d, de);
+  if (! d) { return 0; }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_5_21_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 6, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_5_21_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY( 6, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_5_10_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 7, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_5_10_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 7, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_6_3_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_6_3_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_6_5_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 8, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_6_5_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 8, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_6_6_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 1, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_6_6_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY( 1, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_6_2_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 7, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_6_2_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 7, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_6_0_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_6_0_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_6_9_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 4, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_6_9_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY( 4, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_6_12_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 7, 1);
+  DCOPY( 2, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_6_12_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 7, 1);
+  ECOPY( 2, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_6_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 8, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_6_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY( 8, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_5_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 7, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_5_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 7, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_3_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_3_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_110_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 7, 1);
+  DCOPY( 3, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_110_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 7, 1);
+  ECOPY( 3, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_32_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY(15, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_32_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY(15, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_107_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 6, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_107_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY( 6, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_131_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY(15, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_131_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY(15, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_8_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 8, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_8_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 8, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_55_5(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY(32, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_55_5(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY(32, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_14_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 1, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_14_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY( 1, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_203_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 1, 1);
+  DCOPY( 6, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_203_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY( 1, 1);
+  ECOPY( 6, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_89_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 2, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_89_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY( 2, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_46_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY(13, 1);
+  DCOPY(12, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_46_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY(13, 1);
+  ECOPY(12, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_3_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 7, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_3_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY( 7, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_26_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY(14, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_26_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY(14, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_104_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 5, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_104_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY( 5, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_113_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 7, 1);
+  DCOPY( 7, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_113_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 7, 1);
+  ECOPY( 7, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_60_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY(23, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_60_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY(23, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_50_5(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY(28, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_50_5(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY(28, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_95_5(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY(18, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_95_5(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY(18, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_24_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 7, 1);
+  DCOPY( 2, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_24_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 7, 1);
+  ECOPY( 2, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_20_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 3, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_20_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY( 3, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_124_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 7, 1);
+  DCOPY( 4, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_124_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 7, 1);
+  ECOPY( 4, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_156_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 4, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_156_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY( 4, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_84_5(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY(64, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_84_5(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY(64, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_9_5(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY(39, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_9_5(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY(39, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_48_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY(13, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_48_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY(13, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_122_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 7, 1);
+  DCOPY( 8, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_122_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 7, 1);
+  ECOPY( 8, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_222_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 5, 1);
+  DCOPY( 2, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_222_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY( 5, 1);
+  ECOPY( 2, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_183_6(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 1, 1);
+  DCOPY(24, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_183_6(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY( 1, 1);
+  ECOPY(24, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_156_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  uint32_t              c;
+  uint32_t              n;
+  Fix_t                 F[MAXFIX];
+  uint32_t              nf = 0;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 4, 0);
+  DINLINE(0);
+
+  d = fixdec(F, nf, d, de, s, se);
+  if (! d) { return 0; }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_156_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  const uint8_t * const ss = s;
+  const uint8_t *       f;
+  const uint8_t *       b = s;                          // Before the skip of the last copy.
+  uint32_t              c;
+  uint32_t              n;
+  Fix_t                 F[MAXFIX];
+  uint32_t              nf = 0;
+
+  ECOPYB( 1, 1);
+  ECOPYB( 3, 1);
+  ECOPYB( 4, 0);
+  EINLINE(0);
+
+  d = fixenc(F, nf, d, de);
+  if (! d) { return 0; }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_170_7(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  uint32_t              l;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 2, 0);
+  for (l = s[-1]; l; l--) {
+    DCOPY( 1, 1);
+    DCOPY( 3, 1);
+  }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_170_7(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  const uint8_t *       b = s;                          // Before the skip of the last copy.
+  uint32_t              l;
+
+  ECOPYB( 1, 1);
+  ECOPYB( 3, 1);
+  ECOPYB( 2, 0);
+  for (l = b[-1]; l; l--) {
+    ECOPYB( 1, 1);
+    ECOPYB( 3, 1);
+  }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_195_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  uint32_t              c;
+  uint32_t              n;
+  Fix_t                 F[MAXFIX];
+  uint32_t              nf = 0;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 3, 0);
+  DINLINE(0);
+
+  d = fixdec(F, nf, d, de, s, se);
+  if (! d) { return 0; }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_195_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  const uint8_t * const ss = s;
+  const uint8_t *       f;
+  const uint8_t *       b = s;                          // Before the skip of the last copy.
+  uint32_t              c;
+  uint32_t              n;
+  Fix_t                 F[MAXFIX];
+  uint32_t              nf = 0;
+
+  ECOPYB( 1, 1);
+  ECOPYB( 3, 1);
+  ECOPYB( 3, 0);
+  EINLINE(0);
+
+  d = fixenc(F, nf, d, de);
+  if (! d) { return 0; }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_189_6(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  uint32_t              l;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 3, 0);
+  // Modifier 0.
+  for (l = s[-1]; l; l--) {
+  }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_189_6(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  const uint8_t *       b = s;                          // Before the skip of the last copy.
+  uint32_t              l;
+
+  ECOPYB( 1, 1);
+  ECOPYB( 3, 1);
+  ECOPYB( 3, 0);
+  // Modifier 0.
+  for (l = b[-1]; l; l--) {
+  }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_72_7(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  uint32_t              l;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY(10, 0);
+  // Modifier 0.
+  for (l = s[-1]; l; l--) {
+    DCOPY( 8, 0);
+  }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_72_7(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  const uint8_t *       b = s;                          // Before the skip of the last copy.
+  uint32_t              l;
+
+  ECOPYB( 1, 1);
+  ECOPYB( 3, 1);
+  ECOPYB(10, 0);
+  // Modifier 0.
+  for (l = b[-1]; l; l--) {
+    ECOPYB( 8, 0);
+  }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_100_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 9, 1);
+  DCOPY( 5, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_100_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY( 9, 1);
+  ECOPY( 5, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_36_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 9, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_36_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 9, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_126_5(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  uint32_t              c;
+  uint32_t              n;
+  Fix_t                 F[MAXFIX];
+  uint32_t              nf = 0;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 7, 0);
+  DINLINE(0);
+  DCOPY( 1, 1);
+
+  d = fixdec(F, nf, d, de, s, se);
+  if (! d) { return 0; }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_126_5(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  const uint8_t * const ss = s;
+  const uint8_t *       f;
+  const uint8_t *       b = s;                          // Before the skip of the last copy.
+  uint32_t              c;
+  uint32_t              n;
+  Fix_t                 F[MAXFIX];
+  uint32_t              nf = 0;
+
+  ECOPYB( 1, 1);
+  ECOPYB( 3, 1);
+  ECOPYB( 7, 0);
+  EINLINE(0);
+  ECOPYB( 1, 1);
+
+  d = fixenc(F, nf, d, de);
+  if (! d) { return 0; }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_151_5(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  uint32_t              c;
+  uint32_t              n;
+  Fix_t                 F[MAXFIX];
+  uint32_t              nf = 0;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 5, 0);
+  DINLINE(0);
+  DCOPY( 1, 1);
+
+  d = fixdec(F, nf, d, de, s, se);
+  if (! d) { return 0; }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_151_5(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  const uint8_t * const ss = s;
+  const uint8_t *       f;
+  const uint8_t *       b = s;                          // Before the skip of the last copy.
+  uint32_t              c;
+  uint32_t              n;
+  Fix_t                 F[MAXFIX];
+  uint32_t              nf = 0;
+
+  ECOPYB( 1, 1);
+  ECOPYB( 3, 1);
+  ECOPYB( 5, 0);
+  EINLINE(0);
+  ECOPYB( 1, 1);
+
+  d = fixenc(F, nf, d, de);
+  if (! d) { return 0; }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_161_5(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  uint32_t              c;
+  uint32_t              n;
+  Fix_t                 F[MAXFIX];
+  uint32_t              nf = 0;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 6, 0);
+  DINLINE(0);
+  DCOPY( 1, 1);
+
+  d = fixdec(F, nf, d, de, s, se);
+  if (! d) { return 0; }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_161_5(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  const uint8_t * const ss = s;
+  const uint8_t *       f;
+  const uint8_t *       b = s;                          // Before the skip of the last copy.
+  uint32_t              c;
+  uint32_t              n;
+  Fix_t                 F[MAXFIX];
+  uint32_t              nf = 0;
+
+  ECOPYB( 1, 1);
+  ECOPYB( 3, 1);
+  ECOPYB( 6, 0);
+  EINLINE(0);
+  ECOPYB( 1, 1);
+
+  d = fixenc(F, nf, d, de);
+  if (! d) { return 0; }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_156_5(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  uint32_t              c;
+  uint32_t              n;
+  Fix_t                 F[MAXFIX];
+  uint32_t              nf = 0;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 4, 0);
+  DINLINE(0);
+  DCOPY( 1, 1);
+
+  d = fixdec(F, nf, d, de, s, se);
+  if (! d) { return 0; }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_156_5(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  const uint8_t * const ss = s;
+  const uint8_t *       f;
+  const uint8_t *       b = s;                          // Before the skip of the last copy.
+  uint32_t              c;
+  uint32_t              n;
+  Fix_t                 F[MAXFIX];
+  uint32_t              nf = 0;
+
+  ECOPYB( 1, 1);
+  ECOPYB( 3, 1);
+  ECOPYB( 4, 0);
+  EINLINE(0);
+  ECOPYB( 1, 1);
+
+  d = fixenc(F, nf, d, de);
+  if (! d) { return 0; }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_20_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 3, 1);
+  DCOPY( 4, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_20_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY( 3, 1);
+  ECOPY( 4, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_38_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY(11, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_38_1(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY(11, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_218_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 3, 1);
+  DCOPY( 5, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_218_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY( 3, 1);
+  ECOPY( 5, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_166_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 1, 1);
+  DCOPY( 5, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_166_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY( 1, 1);
+  ECOPY( 5, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_79_5(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY(65, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_79_5(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY(65, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_110_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 7, 1);
+  DCOPY( 3, 1);
+  DCOPY( 3, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_110_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 7, 1);
+  ECOPY( 3, 1);
+  ECOPY( 3, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_120_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 7, 1);
+  DCOPY(11, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_120_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 7, 1);
+  ECOPY(11, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_134_7(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  uint32_t              l;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY(15, 1);
+  for (l = s[-1]; l; l--) {
+    DCOPY( 1, 1);
+    DCOPY( 8, 0);
+  }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_134_7(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  const uint8_t *       b = s;                          // Before the skip of the last copy.
+  uint32_t              l;
+
+  ECOPYB( 1, 1);
+  ECOPYB( 3, 1);
+  ECOPYB(15, 1);
+  for (l = b[-1]; l; l--) {
+    ECOPYB( 1, 1);
+    ECOPYB( 8, 0);
+  }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_141_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  uint32_t              c;
+  uint32_t              n;
+  Fix_t                 F[MAXFIX];
+  uint32_t              nf = 0;
+
+  DCOPY( 9, 1);
+  DINLINE(0);
+  DCOPY( 2, 0);
+
+  d = fixdec(F, nf, d, de, s, se);
+  if (! d) { return 0; }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_141_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  const uint8_t * const ss = s;
+  const uint8_t *       f;
+  const uint8_t *       b = s;                          // Before the skip of the last copy.
+  uint32_t              c;
+  uint32_t              n;
+  Fix_t                 F[MAXFIX];
+  uint32_t              nf = 0;
+
+  ECOPYB( 9, 1);
+  EINLINE(0);
+  ECOPYB( 2, 0);
+
+  d = fixenc(F, nf, d, de);
+  if (! d) { return 0; }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_144_7(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  uint32_t              l;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 9, 1);
+  DCOPY( 6, 0);
+  for (l = s[-1]; l; l--) {
+    DCOPY(14, 0);
+  }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_144_7(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  const uint8_t *       b = s;                          // Before the skip of the last copy.
+  uint32_t              l;
+
+  ECOPYB( 1, 1);
+  ECOPYB( 3, 1);
+  ECOPYB( 9, 1);
+  ECOPYB( 6, 0);
+  for (l = b[-1]; l; l--) {
+    ECOPYB(14, 0);
+  }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_40_6(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  uint32_t              l;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 1, 1);
+  for (l = s[-1]; l; l--) {
+    DCOPY( 4, 0);
+  }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_40_6(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  const uint8_t *       b = s;                          // Before the skip of the last copy.
+  uint32_t              l;
+
+  ECOPYB( 1, 1);
+  ECOPYB( 3, 1);
+  ECOPYB( 1, 1);
+  for (l = b[-1]; l; l--) {
+    ECOPYB( 4, 0);
+  }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_0_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 2, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_0_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY( 2, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_29_5(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY(31, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_29_5(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY(31, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_34_6(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 9, 1);
+  DCOPY(27, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_34_6(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY( 9, 1);
+  ECOPY(27, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_14_6(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  uint32_t              c;
+  uint32_t              n;
+  Fix_t                 F[MAXFIX];
+  uint32_t              nf = 0;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 1, 1);
+  DCOPY( 7, 0);
+  DINLINE(0);
+  DCOPY( 1, 1);
+
+  d = fixdec(F, nf, d, de, s, se);
+  if (! d) { return 0; }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_14_6(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  const uint8_t * const ss = s;
+  const uint8_t *       f;
+  const uint8_t *       b = s;                          // Before the skip of the last copy.
+  uint32_t              c;
+  uint32_t              n;
+  Fix_t                 F[MAXFIX];
+  uint32_t              nf = 0;
+
+  ECOPYB( 1, 1);
+  ECOPYB( 3, 1);
+  ECOPYB( 1, 1);
+  ECOPYB( 7, 0);
+  EINLINE(0);
+  ECOPYB( 1, 1);
+
+  d = fixenc(F, nf, d, de);
+  if (! d) { return 0; }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_226_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  uint32_t              c;
+  uint32_t              n;
+  Fix_t                 F[MAXFIX];
+  uint32_t              nf = 0;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY(13, 0);
+  DINLINE(0);
+
+  d = fixdec(F, nf, d, de, s, se);
+  if (! d) { return 0; }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_226_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  const uint8_t * const ss = s;
+  const uint8_t *       f;
+  const uint8_t *       b = s;                          // Before the skip of the last copy.
+  uint32_t              c;
+  uint32_t              n;
+  Fix_t                 F[MAXFIX];
+  uint32_t              nf = 0;
+
+  ECOPYB( 1, 1);
+  ECOPYB( 3, 1);
+  ECOPYB(13, 0);
+  EINLINE(0);
+
+  d = fixenc(F, nf, d, de);
+  if (! d) { return 0; }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_92_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 7, 1);
+  DCOPY( 2, 2);
+  DCOPY(12, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_92_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 7, 1);
+  ECOPY( 2, 2);
+  ECOPY(12, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_115_5(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 7, 1);
+  DCOPY( 2, 2);
+  DCOPY(28, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_115_5(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 7, 1);
+  ECOPY( 2, 2);
+  ECOPY(28, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_63_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 7, 1);
+  DCOPY( 5, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_63_2(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 7, 1);
+  ECOPY( 5, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_230_5(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  uint32_t              c;
+  uint32_t              n;
+  Fix_t                 F[MAXFIX];
+  uint32_t              nf = 0;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 7, 3);
+  DINLINE(1);
+  DCOPY( 2, 2);
+
+  d = fixdec(F, nf, d, de, s, se);
+  if (! d) { return 0; }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_230_5(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  const uint8_t * const ss = s;
+  const uint8_t *       f;
+  const uint8_t *       b = s;                          // Before the skip of the last copy.
+  uint32_t              c;
+  uint32_t              n;
+  Fix_t                 F[MAXFIX];
+  uint32_t              nf = 0;
+
+  ECOPYB( 1, 1);
+  ECOPYB( 3, 1);
+  ECOPYB( 7, 3);
+  EINLINE(1);
+  ECOPYB( 2, 2);
+
+  d = fixenc(F, nf, d, de);
+  if (! d) { return 0; }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_72_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY(10, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_72_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY(10, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_65_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY(12, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_65_3(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY(12, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_177_6(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 1, 1);
+  DCOPY(26, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_177_6(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY( 1, 1);
+  ECOPY(26, 0);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_211_7(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  uint32_t              l;
+  uint32_t              c;
+  uint32_t              n;
+  Fix_t                 F[MAXFIX];
+  uint32_t              nf = 0;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 2, 0);
+  for (l = s[-1]; l; l--) {
+    DCOPY( 4, 0);
+    DINLINE(1);
+  }
+
+  d = fixdec(F, nf, d, de, s, se);
+  if (! d) { return 0; }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_211_7(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  const uint8_t * const ss = s;
+  const uint8_t *       f;
+  const uint8_t *       b = s;                          // Before the skip of the last copy.
+  uint32_t              l;
+  uint32_t              c;
+  uint32_t              n;
+  Fix_t                 F[MAXFIX];
+  uint32_t              nf = 0;
+
+  ECOPYB( 1, 1);
+  ECOPYB( 3, 1);
+  ECOPYB( 2, 0);
+  for (l = b[-1]; l; l--) {
+    ECOPYB( 4, 0);
+    EINLINE(1);
+  }
+
+  d = fixenc(F, nf, d, de);
+  if (! d) { return 0; }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_207_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  uint32_t              c;
+  uint32_t              n;
+  Fix_t                 F[MAXFIX];
+  uint32_t              nf = 0;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 8, 0);
+  DINLINE(0);
+
+  d = fixdec(F, nf, d, de, s, se);
+  if (! d) { return 0; }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_207_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  const uint8_t * const ss = s;
+  const uint8_t *       f;
+  const uint8_t *       b = s;                          // Before the skip of the last copy.
+  uint32_t              c;
+  uint32_t              n;
+  Fix_t                 F[MAXFIX];
+  uint32_t              nf = 0;
+
+  ECOPYB( 1, 1);
+  ECOPYB( 3, 1);
+  ECOPYB( 8, 0);
+  EINLINE(0);
+
+  d = fixenc(F, nf, d, de);
+  if (! d) { return 0; }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_65_7(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  uint32_t              l;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY(12, 0);
+  // Modifier 0.
+  for (l = s[-1]; l; l--) {
+    DCOPY( 8, 0);
+  }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_65_7(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+  const uint8_t *       b = s;                          // Before the skip of the last copy.
+  uint32_t              l;
+
+  ECOPYB( 1, 1);
+  ECOPYB( 3, 1);
+  ECOPYB(12, 0);
+  // Modifier 0.
+  for (l = b[-1]; l; l--) {
+    ECOPYB( 8, 0);
+  }
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t dec_8_199_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  DCOPY( 1, 1);
+  DCOPY( 3, 1);
+  DCOPY( 1, 1);
+  DCOPY(11, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static uint32_t enc_8_199_4(uint8_t * d, uint32_t dsz, const uint8_t * s, uint32_t ssz) {
+
+  uint8_t * const       ds = d;
+  const uint8_t * const de = d + dsz;
+  const uint8_t * const se = s + ssz;
+
+  ECOPY( 1, 1);
+  ECOPY( 3, 1);
+  ECOPY( 1, 1);
+  ECOPY(11, 1);
+
+  return (uint32_t) (d - ds);
+
+}
+
+static const CodecFun_t CFun_0[103] = {
+  { dec_0_13_1, enc_0_13_1 }, //   0 event 0x01
+  { dec_0_66_4, enc_0_66_4 }, //   1 subevent 0x01
+  { dec_0_33_6, enc_0_33_6 }, //   2 event 0x02
+  { dec_0_46_6, enc_0_46_6 }, //   3 subevent 0x02
+  { dec_0_8_3, enc_0_8_3 }, //   4 event 0x03
+  { dec_0_74_2, enc_0_74_2 }, //   5 subevent 0x03
+  { dec_0_14_1, enc_0_14_1 }, //   6 event 0x04
+  { dec_0_135_2, enc_0_135_2 }, //   7 subevent 0x04
+  { dec_0_18_3, enc_0_18_3 }, //   8 event 0x05
+  { dec_0_29_3, enc_0_29_3 }, //   9 subevent 0x05
+  { dec_0_3_3, enc_0_3_3 }, //  10 event 0x06
+  { dec_0_87_1, enc_0_87_1 }, //  11 subevent 0x06
+  { dec_0_178_3, enc_0_178_3 }, //  12 event 0x07
+  { dec_0_87_1, enc_0_87_1 }, //  13 subevent 0x07
+  { dec_0_18_3, enc_0_18_3 }, //  14 event 0x08
+  { dec_0_132_3, enc_0_132_3 }, //  15 subevent 0x08
+  { dec_0_3_3, enc_0_3_3 }, //  16 event 0x09
+  { dec_0_107_3, enc_0_107_3 }, //  17 subevent 0x09
+  { dec_0_18_3, enc_0_18_3 }, //  18 event 0x0a
+  { dec_0_98_4, enc_0_98_4 }, //  19 subevent 0x0a
+  { dec_0_8_3, enc_0_8_3 }, //  20 event 0x0b
+  { dec_0_88_6, enc_0_88_6 }, //  21 subevent 0x0b
+  { dec_0_171_4, enc_0_171_4 }, //  22 event 0x0c
+  { dec_0_130_2, enc_0_130_2 }, //  23 subevent 0x0c
+  { dec_0_162_6, enc_0_162_6 }, //  24 event 0x0d
+  { dec_0_102_5, enc_0_102_5 }, //  25 subevent 0x0d
+  { dec_0_0_1, enc_0_0_1 }, //  26 event 0x0e
+  { dec_0_121_3, enc_0_121_3 }, //  27 subevent 0x0e
+  { dec_0_6_2, enc_0_6_2 }, //  28 event 0x0f
+  { dec_0_16_2, enc_0_16_2 }, //  29 subevent 0x0f
+  { dec_0_13_1, enc_0_13_1 }, //  30 event 0x10
+  { dec_0_57_1, enc_0_57_1 }, //  31 subevent 0x10
+  { dec_0_1_2, enc_0_1_2 }, //  32 event 0x11
+  { dec_0_13_1, enc_0_13_1 }, //  33 subevent 0x11
+  { dec_0_10_1, enc_0_10_1 }, //  34 event 0x12
+  { dec_0_52_1, enc_0_52_1 }, //  35 subevent 0x12
+  { dec_0_158_4, enc_0_158_4 }, //  36 event 0x13
+  { dec_0_45_1, enc_0_45_1 }, //  37 subevent 0x13
+  { dec_0_149_4, enc_0_149_4 }, //  38 event 0x14
+  { dec_0_35_1, enc_0_35_1 }, //  39 subevent 0x14
+  { dec_0_181_6, enc_0_181_6 }, //  40 event 0x15
+  { dec_0_76_5, enc_0_76_5 }, //  41 subevent 0x15
+  { dec_0_44_1, enc_0_44_1 }, //  42 event 0x16
+  { dec_0_70_4, enc_0_70_4 }, //  43 subevent 0x16
+  { dec_0_44_1, enc_0_44_1 }, //  44 event 0x17
+  { dec_0_6_2, enc_0_6_2 }, //  45 subevent 0x17
+  { dec_0_141_3, enc_0_141_3 }, //  46 event 0x18
+  { dec_0_127_3, enc_0_127_3 }, //  47 subevent 0x18
+  { dec_0_146_1, enc_0_146_1 }, //  48 event 0x19
+  { dec_0_61_5, enc_0_61_5 }, //  49 subevent 0x19
+  { dec_0_13_1, enc_0_13_1 }, //  50 event 0x1a
+  { dec_0_10_1, enc_0_10_1 }, //  51 subevent 0x1a
+  { dec_0_147_2, enc_0_147_2 }, //  52 event 0x1b
+  { dec_0_81_6, enc_0_81_6 }, //  53 subevent 0x1b
+  { dec_0_11_3, enc_0_11_3 }, //  54 event 0x1c
+  { dec_0_57_1, enc_0_57_1 }, //  55 subevent 0x1c
+  { dec_0_11_3, enc_0_11_3 }, //  56 event 0x1d
+  { dec_0_53_4, enc_0_53_4 }, //  57 subevent 0x1d
+  { dec_0_1_2, enc_0_1_2 }, //  58 event 0x1e
+  { dec_0_57_1, enc_0_57_1 }, //  59 subevent 0x1e
+  { dec_0_137_2, enc_0_137_2 }, //  60 subevent 0x1f
+  { dec_0_10_1, enc_0_10_1 }, //  61 event 0x20
+  { dec_0_75_1, enc_0_75_1 }, //  62 subevent 0x20
+  { dec_0_25_7, enc_0_25_7 }, //  63 event 0x21
+  { dec_0_139_2, enc_0_139_2 }, //  64 subevent 0x21
+  { dec_0_39_5, enc_0_39_5 }, //  65 event 0x22
+  { dec_0_58_3, enc_0_58_3 }, //  66 subevent 0x22
+  { dec_0_168_3, enc_0_168_3 }, //  67 event 0x23
+  { dec_0_135_2, enc_0_135_2 }, //  68 subevent 0x23
+  { dec_0_118_3, enc_0_118_3 }, //  69 subevent 0x24
+  { dec_0_110_3, enc_0_110_3 }, //  70 subevent 0x25
+  { dec_0_124_3, enc_0_124_3 }, //  71 subevent 0x26
+  { dec_0_32_1, enc_0_32_1 }, //  72 subevent 0x27
+  { dec_0_113_5, enc_0_113_5 }, //  73 subevent 0x28
+  { dec_0_94_4, enc_0_94_4 }, //  74 subevent 0x29
+  { dec_0_195_4, enc_0_195_4 }, //  75 event 0x2c
+  { dec_0_192_3, enc_0_192_3 }, //  76 event 0x2d
+  { dec_0_8_3, enc_0_8_3 }, //  77 event 0x2e
+  { dec_0_21_4, enc_0_21_4 }, //  78 event 0x2f
+  { dec_0_3_3, enc_0_3_3 }, //  79 event 0x30
+  { dec_0_44_1, enc_0_44_1 }, //  80 event 0x31
+  { dec_0_45_1, enc_0_45_1 }, //  81 event 0x32
+  { dec_0_202_2, enc_0_202_2 }, //  82 event 0x33
+  { dec_0_44_1, enc_0_44_1 }, //  83 event 0x34
+  { dec_0_44_1, enc_0_44_1 }, //  84 event 0x35
+  { dec_0_10_1, enc_0_10_1 }, //  85 event 0x36
+  { dec_0_144_2, enc_0_144_2 }, //  86 event 0x38
+  { dec_0_1_2, enc_0_1_2 }, //  87 event 0x39
+  { dec_0_202_2, enc_0_202_2 }, //  88 event 0x3b
+  { dec_0_10_1, enc_0_10_1 }, //  89 event 0x3c
+  { dec_0_175_3, enc_0_175_3 }, //  90 event 0x3d
+  { dec_0_153_5, enc_0_153_5 }, //  91 event 0x48
+  { dec_0_199_3, enc_0_199_3 }, //  92 event 0x4e
+  { dec_0_13_1, enc_0_13_1 }, //  93 event 0x4f
+  { dec_0_189_3, enc_0_189_3 }, //  94 event 0x50
+  { dec_0_15_3, enc_0_15_3 }, //  95 event 0x51
+  { dec_0_10_1, enc_0_10_1 }, //  96 event 0x52
+  { dec_0_10_1, enc_0_10_1 }, //  97 event 0x53
+  { dec_0_14_1, enc_0_14_1 }, //  98 event 0x55
+  { dec_0_32_1, enc_0_32_1 }, //  99 event 0x56
+  { dec_0_1_2, enc_0_1_2 }, // 100 event 0x57
+  { dec_0_187_2, enc_0_187_2 }, // 101 event 0x58
+  { dec_0_11_3, enc_0_11_3 }, // 102 event 0x59
+};
+
+static const CodecFun_t CFun_1[67] = {
+  { dec_1_41_3, enc_1_41_3 }, //   0 OCF 0x01 cmd
+  { dec_1_3_2, enc_1_3_2 }, //   1 OCF 0x02 cmd
+  { dec_1_2_1, enc_1_2_1 }, //   2 OCF 0x02 ret
+  { dec_1_47_3, enc_1_47_3 }, //   3 OCF 0x03 cmd
+  { dec_1_2_1, enc_1_2_1 }, //   4 OCF 0x03 ret
+  { dec_1_3_2, enc_1_3_2 }, //   5 OCF 0x04 cmd
+  { dec_1_2_1, enc_1_2_1 }, //   6 OCF 0x04 ret
+  { dec_1_19_3, enc_1_19_3 }, //   7 OCF 0x05 cmd
+  { dec_1_22_3, enc_1_22_3 }, //   8 OCF 0x06 cmd
+  { dec_1_15_3, enc_1_15_3 }, //   9 OCF 0x08 cmd
+  { dec_1_18_1, enc_1_18_1 }, //  10 OCF 0x08 ret
+  { dec_1_0_3, enc_1_0_3 }, //  11 OCF 0x09 cmd
+  { dec_1_44_3, enc_1_44_3 }, //  12 OCF 0x0a cmd
+  { dec_1_50_5, enc_1_50_5 }, //  13 OCF 0x0b cmd
+  { dec_1_18_1, enc_1_18_1 }, //  14 OCF 0x0b ret
+  { dec_1_15_3, enc_1_15_3 }, //  15 OCF 0x0c cmd
+  { dec_1_18_1, enc_1_18_1 }, //  16 OCF 0x0c ret
+  { dec_1_58_5, enc_1_58_5 }, //  17 OCF 0x0d cmd
+  { dec_1_18_1, enc_1_18_1 }, //  18 OCF 0x0d ret
+  { dec_1_15_3, enc_1_15_3 }, //  19 OCF 0x0e cmd
+  { dec_1_18_1, enc_1_18_1 }, //  20 OCF 0x0e ret
+  { dec_1_12_3, enc_1_12_3 }, //  21 OCF 0x0f cmd
+  { dec_1_9_3, enc_1_9_3 }, //  22 OCF 0x11 cmd
+  { dec_1_22_3, enc_1_22_3 }, //  23 OCF 0x13 cmd
+  { dec_1_9_3, enc_1_9_3 }, //  24 OCF 0x15 cmd
+  { dec_1_55_3, enc_1_55_3 }, //  25 OCF 0x17 cmd
+  { dec_1_69_3, enc_1_69_3 }, //  26 OCF 0x19 cmd
+  { dec_1_15_3, enc_1_15_3 }, //  27 OCF 0x1a cmd
+  { dec_1_18_1, enc_1_18_1 }, //  28 OCF 0x1a ret
+  { dec_1_9_3, enc_1_9_3 }, //  29 OCF 0x1b cmd
+  { dec_1_22_3, enc_1_22_3 }, //  30 OCF 0x1c cmd
+  { dec_1_9_3, enc_1_9_3 }, //  31 OCF 0x1d cmd
+  { dec_1_9_3, enc_1_9_3 }, //  32 OCF 0x1f cmd
+  { dec_1_9_3, enc_1_9_3 }, //  33 OCF 0x20 cmd
+  { dec_1_63_3, enc_1_63_3 }, //  34 OCF 0x20 ret
+  { dec_1_91_4, enc_1_91_4 }, //  35 OCF 0x28 cmd
+  { dec_1_3_6, enc_1_3_6 }, //  36 OCF 0x29 cmd
+  { dec_1_44_3, enc_1_44_3 }, //  37 OCF 0x2a cmd
+  { dec_1_47_3, enc_1_47_3 }, //  38 OCF 0x2b cmd
+  { dec_1_18_1, enc_1_18_1 }, //  39 OCF 0x2b ret
+  { dec_1_15_3, enc_1_15_3 }, //  40 OCF 0x2c cmd
+  { dec_1_18_1, enc_1_18_1 }, //  41 OCF 0x2c ret
+  { dec_1_15_3, enc_1_15_3 }, //  42 OCF 0x2d cmd
+  { dec_1_18_1, enc_1_18_1 }, //  43 OCF 0x2d ret
+  { dec_1_99_3, enc_1_99_3 }, //  44 OCF 0x2e cmd
+  { dec_1_18_1, enc_1_18_1 }, //  45 OCF 0x2e ret
+  { dec_1_15_3, enc_1_15_3 }, //  46 OCF 0x2f cmd
+  { dec_1_18_1, enc_1_18_1 }, //  47 OCF 0x2f ret
+  { dec_1_72_5, enc_1_72_5 }, //  48 OCF 0x30 cmd
+  { dec_1_18_1, enc_1_18_1 }, //  49 OCF 0x30 ret
+  { dec_1_15_3, enc_1_15_3 }, //  50 OCF 0x33 cmd
+  { dec_1_18_1, enc_1_18_1 }, //  51 OCF 0x33 ret
+  { dec_1_44_3, enc_1_44_3 }, //  52 OCF 0x34 cmd
+  { dec_1_18_1, enc_1_18_1 }, //  53 OCF 0x34 ret
+  { dec_1_33_8, enc_1_33_8 }, //  54 OCF 0x3d cmd
+  { dec_1_25_8, enc_1_25_8 }, //  55 OCF 0x3e cmd
+  { dec_1_95_4, enc_1_95_4 }, //  56 OCF 0x3f cmd
+  { dec_1_15_3, enc_1_15_3 }, //  57 OCF 0x40 cmd
+  { dec_1_18_1, enc_1_18_1 }, //  58 OCF 0x40 ret
+  { dec_1_82_4, enc_1_82_4 }, //  59 OCF 0x41 cmd
+  { dec_1_71_1, enc_1_71_1 }, //  60 OCF 0x41 ret
+  { dec_1_86_5, enc_1_86_5 }, //  61 OCF 0x42 cmd
+  { dec_1_18_1, enc_1_18_1 }, //  62 OCF 0x42 ret
+  { dec_1_3_2, enc_1_3_2 }, //  63 OCF 0x43 cmd
+  { dec_1_66_3, enc_1_66_3 }, //  64 OCF 0x44 cmd
+  { dec_1_77_5, enc_1_77_5 }, //  65 OCF 0x45 cmd
+  { dec_1_18_1, enc_1_18_1 }, //  66 OCF 0x45 ret
+};
+
+static const CodecFun_t CFun_2[18] = {
+  { dec_2_10_3, enc_2_10_3 }, //   0 OCF 0x01 cmd
+  { dec_2_28_3, enc_2_28_3 }, //   1 OCF 0x03 cmd
+  { dec_2_0_3, enc_2_0_3 }, //   2 OCF 0x04 cmd
+  { dec_2_13_6, enc_2_13_6 }, //   3 OCF 0x07 cmd
+  { dec_2_21_3, enc_2_21_3 }, //   4 OCF 0x09 cmd
+  { dec_2_26_2, enc_2_26_2 }, //   5 OCF 0x09 ret
+  { dec_2_34_3, enc_2_34_3 }, //   6 OCF 0x0b cmd
+  { dec_2_21_3, enc_2_21_3 }, //   7 OCF 0x0c cmd
+  { dec_2_24_2, enc_2_24_2 }, //   8 OCF 0x0c ret
+  { dec_2_37_3, enc_2_37_3 }, //   9 OCF 0x0d cmd
+  { dec_2_19_2, enc_2_19_2 }, //  10 OCF 0x0d ret
+  { dec_2_3_2, enc_2_3_2 }, //  11 OCF 0x0e cmd
+  { dec_2_19_2, enc_2_19_2 }, //  12 OCF 0x0e ret
+  { dec_2_21_3, enc_2_21_3 }, //  13 OCF 0x0f cmd
+  { dec_2_19_1, enc_2_19_1 }, //  14 OCF 0x0f ret
+  { dec_2_3_7, enc_2_3_7 }, //  15 OCF 0x10 cmd
+  { dec_2_31_3, enc_2_31_3 }, //  16 OCF 0x11 cmd
+  { dec_2_19_2, enc_2_19_2 }, //  17 OCF 0x11 ret
+};
+
+static const CodecFun_t CFun_3[185] = {
+  { dec_3_64_3, enc_3_64_3 }, //   0 OCF 0x01 cmd
+  { dec_3_4_1, enc_3_4_1 }, //   1 OCF 0x01 ret
+  { dec_3_5_2, enc_3_5_2 }, //   2 OCF 0x03 cmd
+  { dec_3_4_1, enc_3_4_1 }, //   3 OCF 0x03 ret
+  { dec_3_64_3, enc_3_64_3 }, //   4 OCF 0x05 cmd
+  { dec_3_4_1, enc_3_4_1 }, //   5 OCF 0x05 ret
+  { dec_3_17_3, enc_3_17_3 }, //   6 OCF 0x08 cmd
+  { dec_3_12_2, enc_3_12_2 }, //   7 OCF 0x08 ret
+  { dec_3_5_2, enc_3_5_2 }, //   8 OCF 0x09 cmd
+  { dec_3_8_1, enc_3_8_1 }, //   9 OCF 0x09 ret
+  { dec_3_5_3, enc_3_5_3 }, //  10 OCF 0x0a cmd
+  { dec_3_4_1, enc_3_4_1 }, //  11 OCF 0x0a ret
+  { dec_3_9_3, enc_3_9_3 }, //  12 OCF 0x0d cmd
+  { dec_3_30_2, enc_3_30_2 }, //  13 OCF 0x0d ret
+  { dec_3_110_8, enc_3_110_8 }, //  14 OCF 0x11 cmd
+  { dec_3_8_1, enc_3_8_1 }, //  15 OCF 0x11 ret
+  { dec_3_9_3, enc_3_9_3 }, //  16 OCF 0x12 cmd
+  { dec_3_12_2, enc_3_12_2 }, //  17 OCF 0x12 ret
+  { dec_3_105_5, enc_3_105_5 }, //  18 OCF 0x13 cmd
+  { dec_3_4_1, enc_3_4_1 }, //  19 OCF 0x13 ret
+  { dec_3_5_2, enc_3_5_2 }, //  20 OCF 0x14 cmd
+  { dec_3_42_3, enc_3_42_3 }, //  21 OCF 0x14 ret
+  { dec_3_5_2, enc_3_5_2 }, //  22 OCF 0x15 cmd
+  { dec_3_12_2, enc_3_12_2 }, //  23 OCF 0x15 ret
+  { dec_3_17_3, enc_3_17_3 }, //  24 OCF 0x16 cmd
+  { dec_3_4_1, enc_3_4_1 }, //  25 OCF 0x16 ret
+  { dec_3_5_2, enc_3_5_2 }, //  26 OCF 0x17 cmd
+  { dec_3_12_2, enc_3_12_2 }, //  27 OCF 0x17 ret
+  { dec_3_17_3, enc_3_17_3 }, //  28 OCF 0x18 cmd
+  { dec_3_4_1, enc_3_4_1 }, //  29 OCF 0x18 ret
+  { dec_3_5_2, enc_3_5_2 }, //  30 OCF 0x19 cmd
+  { dec_3_8_1, enc_3_8_1 }, //  31 OCF 0x19 ret
+  { dec_3_5_3, enc_3_5_3 }, //  32 OCF 0x1a cmd
+  { dec_3_4_1, enc_3_4_1 }, //  33 OCF 0x1a ret
+  { dec_3_5_2, enc_3_5_2 }, //  34 OCF 0x1b cmd
+  { dec_3_30_2, enc_3_30_2 }, //  35 OCF 0x1b ret
+  { dec_3_92_3, enc_3_92_3 }, //  36 OCF 0x1c cmd
+  { dec_3_4_1, enc_3_4_1 }, //  37 OCF 0x1c ret
+  { dec_3_5_2, enc_3_5_2 }, //  38 OCF 0x1d cmd
+  { dec_3_30_2, enc_3_30_2 }, //  39 OCF 0x1d ret
+  { dec_3_92_3, enc_3_92_3 }, //  40 OCF 0x1e cmd
+  { dec_3_4_1, enc_3_4_1 }, //  41 OCF 0x1e ret
+  { dec_3_5_2, enc_3_5_2 }, //  42 OCF 0x1f cmd
+  { dec_3_8_1, enc_3_8_1 }, //  43 OCF 0x1f ret
+  { dec_3_5_3, enc_3_5_3 }, //  44 OCF 0x20 cmd
+  { dec_3_4_1, enc_3_4_1 }, //  45 OCF 0x20 ret
+  { dec_3_5_2, enc_3_5_2 }, //  46 OCF 0x23 cmd
+  { dec_3_32_1, enc_3_32_1 }, //  47 OCF 0x23 ret
+  { dec_3_14_3, enc_3_14_3 }, //  48 OCF 0x24 cmd
+  { dec_3_4_1, enc_3_4_1 }, //  49 OCF 0x24 ret
+  { dec_3_5_2, enc_3_5_2 }, //  50 OCF 0x25 cmd
+  { dec_3_12_2, enc_3_12_2 }, //  51 OCF 0x25 ret
+  { dec_3_17_3, enc_3_17_3 }, //  52 OCF 0x26 cmd
+  { dec_3_4_1, enc_3_4_1 }, //  53 OCF 0x26 ret
+  { dec_3_17_3, enc_3_17_3 }, //  54 OCF 0x27 cmd
+  { dec_3_30_2, enc_3_30_2 }, //  55 OCF 0x27 ret
+  { dec_3_92_3, enc_3_92_3 }, //  56 OCF 0x28 cmd
+  { dec_3_12_2, enc_3_12_2 }, //  57 OCF 0x28 ret
+  { dec_3_5_2, enc_3_5_2 }, //  58 OCF 0x29 cmd
+  { dec_3_8_1, enc_3_8_1 }, //  59 OCF 0x29 ret
+  { dec_3_5_3, enc_3_5_3 }, //  60 OCF 0x2a cmd
+  { dec_3_4_1, enc_3_4_1 }, //  61 OCF 0x2a ret
+  { dec_3_5_2, enc_3_5_2 }, //  62 OCF 0x2b cmd
+  { dec_3_8_1, enc_3_8_1 }, //  63 OCF 0x2b ret
+  { dec_3_5_3, enc_3_5_3 }, //  64 OCF 0x2c cmd
+  { dec_3_4_1, enc_3_4_1 }, //  65 OCF 0x2c ret
+  { dec_3_14_3, enc_3_14_3 }, //  66 OCF 0x2d cmd
+  { dec_3_54_2, enc_3_54_2 }, //  67 OCF 0x2d ret
+  { dec_3_5_2, enc_3_5_2 }, //  68 OCF 0x2e cmd
+  { dec_3_8_1, enc_3_8_1 }, //  69 OCF 0x2e ret
+  { dec_3_5_3, enc_3_5_3 }, //  70 OCF 0x2f cmd
+  { dec_3_4_1, enc_3_4_1 }, //  71 OCF 0x2f ret
+  { dec_3_5_3, enc_3_5_3 }, //  72 OCF 0x31 cmd
+  { dec_3_4_1, enc_3_4_1 }, //  73 OCF 0x31 ret
+  { dec_3_20_4, enc_3_20_4 }, //  74 OCF 0x33 cmd
+  { dec_3_4_1, enc_3_4_1 }, //  75 OCF 0x33 ret
+  { dec_3_24_6, enc_3_24_6 }, //  76 OCF 0x35 cmd
+  { dec_3_17_3, enc_3_17_3 }, //  77 OCF 0x36 cmd
+  { dec_3_30_2, enc_3_30_2 }, //  78 OCF 0x36 ret
+  { dec_3_92_3, enc_3_92_3 }, //  79 OCF 0x37 cmd
+  { dec_3_12_2, enc_3_12_2 }, //  80 OCF 0x37 ret
+  { dec_3_5_2, enc_3_5_2 }, //  81 OCF 0x38 cmd
+  { dec_3_8_1, enc_3_8_1 }, //  82 OCF 0x38 ret
+  { dec_3_5_2, enc_3_5_2 }, //  83 OCF 0x39 cmd
+  { dec_3_33_3, enc_3_33_3 }, //  84 OCF 0x39 ret
+  { dec_3_95_5, enc_3_95_5 }, //  85 OCF 0x3a cmd
+  { dec_3_4_1, enc_3_4_1 }, //  86 OCF 0x3a ret
+  { dec_3_57_3, enc_3_57_3 }, //  87 OCF 0x3f cmd
+  { dec_3_4_1, enc_3_4_1 }, //  88 OCF 0x3f ret
+  { dec_3_5_2, enc_3_5_2 }, //  89 OCF 0x42 cmd
+  { dec_3_8_1, enc_3_8_1 }, //  90 OCF 0x42 ret
+  { dec_3_5_3, enc_3_5_3 }, //  91 OCF 0x43 cmd
+  { dec_3_4_1, enc_3_4_1 }, //  92 OCF 0x43 ret
+  { dec_3_5_2, enc_3_5_2 }, //  93 OCF 0x44 cmd
+  { dec_3_8_1, enc_3_8_1 }, //  94 OCF 0x44 ret
+  { dec_3_5_3, enc_3_5_3 }, //  95 OCF 0x45 cmd
+  { dec_3_4_1, enc_3_4_1 }, //  96 OCF 0x45 ret
+  { dec_3_5_2, enc_3_5_2 }, //  97 OCF 0x46 cmd
+  { dec_3_8_1, enc_3_8_1 }, //  98 OCF 0x46 ret
+  { dec_3_5_3, enc_3_5_3 }, //  99 OCF 0x47 cmd
+  { dec_3_4_1, enc_3_4_1 }, // 100 OCF 0x47 ret
+  { dec_3_5_2, enc_3_5_2 }, // 101 OCF 0x48 cmd
+  { dec_3_8_1, enc_3_8_1 }, // 102 OCF 0x48 ret
+  { dec_3_5_3, enc_3_5_3 }, // 103 OCF 0x49 cmd
+  { dec_3_4_1, enc_3_4_1 }, // 104 OCF 0x49 ret
+  { dec_3_5_2, enc_3_5_2 }, // 105 OCF 0x51 cmd
+  { dec_3_38_3, enc_3_38_3 }, // 106 OCF 0x51 ret
+  { dec_3_100_5, enc_3_100_5 }, // 107 OCF 0x52 cmd
+  { dec_3_4_1, enc_3_4_1 }, // 108 OCF 0x52 ret
+  { dec_3_17_3, enc_3_17_3 }, // 109 OCF 0x53 cmd
+  { dec_3_5_2, enc_3_5_2 }, // 110 OCF 0x55 cmd
+  { dec_3_8_1, enc_3_8_1 }, // 111 OCF 0x55 ret
+  { dec_3_5_3, enc_3_5_3 }, // 112 OCF 0x56 cmd
+  { dec_3_4_1, enc_3_4_1 }, // 113 OCF 0x56 ret
+  { dec_3_5_2, enc_3_5_2 }, // 114 OCF 0x57 cmd
+  { dec_3_45_3, enc_3_45_3 }, // 115 OCF 0x57 ret
+  { dec_3_5_2, enc_3_5_2 }, // 116 OCF 0x58 cmd
+  { dec_3_8_1, enc_3_8_1 }, // 117 OCF 0x58 ret
+  { dec_3_5_3, enc_3_5_3 }, // 118 OCF 0x59 cmd
+  { dec_3_4_1, enc_3_4_1 }, // 119 OCF 0x59 ret
+  { dec_3_5_2, enc_3_5_2 }, // 120 OCF 0x5a cmd
+  { dec_3_8_1, enc_3_8_1 }, // 121 OCF 0x5a ret
+  { dec_3_5_3, enc_3_5_3 }, // 122 OCF 0x5b cmd
+  { dec_3_4_1, enc_3_4_1 }, // 123 OCF 0x5b ret
+  { dec_3_14_3, enc_3_14_3 }, // 124 OCF 0x5f cmd
+  { dec_3_9_3, enc_3_9_3 }, // 125 OCF 0x60 cmd
+  { dec_3_56_1, enc_3_56_1 }, // 126 OCF 0x60 ret
+  { dec_3_64_3, enc_3_64_3 }, // 127 OCF 0x63 cmd
+  { dec_3_4_1, enc_3_4_1 }, // 128 OCF 0x63 ret
+  { dec_3_5_2, enc_3_5_2 }, // 129 OCF 0x66 cmd
+  { dec_3_8_1, enc_3_8_1 }, // 130 OCF 0x66 ret
+  { dec_3_5_3, enc_3_5_3 }, // 131 OCF 0x67 cmd
+  { dec_3_4_1, enc_3_4_1 }, // 132 OCF 0x67 ret
+  { dec_3_14_3, enc_3_14_3 }, // 133 OCF 0x68 cmd
+  { dec_3_36_2, enc_3_36_2 }, // 134 OCF 0x68 ret
+  { dec_3_5_2, enc_3_5_2 }, // 135 OCF 0x6c cmd
+  { dec_3_41_1, enc_3_41_1 }, // 136 OCF 0x6c ret
+  { dec_3_17_3, enc_3_17_3 }, // 137 OCF 0x6d cmd
+  { dec_3_4_1, enc_3_4_1 }, // 138 OCF 0x6d ret
+  { dec_3_73_4, enc_3_73_4 }, // 139 OCF 0x6e cmd
+  { dec_3_4_1, enc_3_4_1 }, // 140 OCF 0x6e ret
+  { dec_3_67_6, enc_3_67_6 }, // 141 OCF 0x6f cmd
+  { dec_3_4_1, enc_3_4_1 }, // 142 OCF 0x6f ret
+  { dec_3_77_5, enc_3_77_5 }, // 143 OCF 0x70 cmd
+  { dec_3_82_4, enc_3_82_4 }, // 144 OCF 0x70 ret
+  { dec_3_5_4, enc_3_5_4 }, // 145 OCF 0x71 cmd
+  { dec_3_4_1, enc_3_4_1 }, // 146 OCF 0x71 ret
+  { dec_3_24_6, enc_3_24_6 }, // 147 OCF 0x72 cmd
+  { dec_3_4_1, enc_3_4_1 }, // 148 OCF 0x72 ret
+  { dec_3_86_6, enc_3_86_6 }, // 149 OCF 0x73 cmd
+  { dec_3_4_1, enc_3_4_1 }, // 150 OCF 0x73 ret
+  { dec_3_5_3, enc_3_5_3 }, // 151 OCF 0x74 cmd
+  { dec_3_8_1, enc_3_8_1 }, // 152 OCF 0x74 ret
+  { dec_3_5_3, enc_3_5_3 }, // 153 OCF 0x75 cmd
+  { dec_3_8_1, enc_3_8_1 }, // 154 OCF 0x75 ret
+  { dec_3_60_4, enc_3_60_4 }, // 155 OCF 0x76 cmd
+  { dec_3_8_1, enc_3_8_1 }, // 156 OCF 0x76 ret
+  { dec_3_5_2, enc_3_5_2 }, // 157 OCF 0x77 cmd
+  { dec_3_51_3, enc_3_51_3 }, // 158 OCF 0x77 ret
+  { dec_3_118_4, enc_3_118_4 }, // 159 OCF 0x78 cmd
+  { dec_3_12_2, enc_3_12_2 }, // 160 OCF 0x78 ret
+  { dec_3_5_2, enc_3_5_2 }, // 161 OCF 0x79 cmd
+  { dec_3_8_1, enc_3_8_1 }, // 162 OCF 0x79 ret
+  { dec_3_5_3, enc_3_5_3 }, // 163 OCF 0x7a cmd
+  { dec_3_4_1, enc_3_4_1 }, // 164 OCF 0x7a ret
+  { dec_3_17_3, enc_3_17_3 }, // 165 OCF 0x7b cmd
+  { dec_3_30_2, enc_3_30_2 }, // 166 OCF 0x7b ret
+  { dec_3_92_3, enc_3_92_3 }, // 167 OCF 0x7c cmd
+  { dec_3_12_2, enc_3_12_2 }, // 168 OCF 0x7c ret
+  { dec_3_5_2, enc_3_5_2 }, // 169 OCF 0x7d cmd
+  { dec_3_48_3, enc_3_48_3 }, // 170 OCF 0x7d ret
+  { dec_3_5_2, enc_3_5_2 }, // 171 OCF 0x7e cmd
+  { dec_3_12_2, enc_3_12_2 }, // 172 OCF 0x7e ret
+  { dec_3_17_3, enc_3_17_3 }, // 173 OCF 0x7f cmd
+  { dec_3_4_1, enc_3_4_1 }, // 174 OCF 0x7f ret
+  { dec_3_5_2, enc_3_5_2 }, // 175 OCF 0x80 cmd
+  { dec_3_12_2, enc_3_12_2 }, // 176 OCF 0x80 ret
+  { dec_3_17_3, enc_3_17_3 }, // 177 OCF 0x81 cmd
+  { dec_3_4_1, enc_3_4_1 }, // 178 OCF 0x81 ret
+  { dec_3_17_3, enc_3_17_3 }, // 179 OCF 0x82 cmd
+  { dec_3_4_1, enc_3_4_1 }, // 180 OCF 0x82 ret
+  { dec_3_0_4, enc_3_0_4 }, // 181 OCF 0x83 cmd
+  { dec_3_4_1, enc_3_4_1 }, // 182 OCF 0x83 ret
+  { dec_3_5_3, enc_3_5_3 }, // 183 OCF 0x84 cmd
+  { dec_3_4_1, enc_3_4_1 }, // 184 OCF 0x84 ret
+};
+
+static const CodecFun_t CFun_4[24] = {
+  { dec_4_3_2, enc_4_3_2 }, //   0 OCF 0x01 cmd
+  { dec_4_36_2, enc_4_36_2 }, //   1 OCF 0x01 ret
+  { dec_4_3_2, enc_4_3_2 }, //   2 OCF 0x02 cmd
+  { dec_4_28_3, enc_4_28_3 }, //   3 OCF 0x02 ret
+  { dec_4_3_2, enc_4_3_2 }, //   4 OCF 0x03 cmd
+  { dec_4_35_1, enc_4_35_1 }, //   5 OCF 0x03 ret
+  { dec_4_10_3, enc_4_10_3 }, //   6 OCF 0x04 cmd
+  { dec_4_13_3, enc_4_13_3 }, //   7 OCF 0x04 ret
+  { dec_4_3_2, enc_4_3_2 }, //   8 OCF 0x05 cmd
+  { dec_4_5_3, enc_4_5_3 }, //   9 OCF 0x05 ret
+  { dec_4_0_2, enc_4_0_2 }, //  10 OCF 0x09 cmd
+  { dec_4_2_1, enc_4_2_1 }, //  11 OCF 0x09 ret
+  { dec_4_3_2, enc_4_3_2 }, //  12 OCF 0x0a cmd
+  { dec_4_8_2, enc_4_8_2 }, //  13 OCF 0x0a ret
+  { dec_4_3_2, enc_4_3_2 }, //  14 OCF 0x0b cmd
+  { dec_4_25_3, enc_4_25_3 }, //  15 OCF 0x0b ret
+  { dec_4_3_2, enc_4_3_2 }, //  16 OCF 0x0c cmd
+  { dec_4_16_1, enc_4_16_1 }, //  17 OCF 0x0c ret
+  { dec_4_3_2, enc_4_3_2 }, //  18 OCF 0x0d cmd
+  { dec_4_22_3, enc_4_22_3 }, //  19 OCF 0x0d ret
+  { dec_4_3_3, enc_4_3_3 }, //  20 OCF 0x0e cmd
+  { dec_4_17_5, enc_4_17_5 }, //  21 OCF 0x0e ret
+  { dec_4_31_4, enc_4_31_4 }, //  22 OCF 0x0f cmd
+  { dec_4_2_1, enc_4_2_1 }, //  23 OCF 0x0f ret
+};
+
+static const CodecFun_t CFun_5[18] = {
+  { dec_5_7_3, enc_5_7_3 }, //   0 OCF 0x01 cmd
+  { dec_5_17_2, enc_5_17_2 }, //   1 OCF 0x01 ret
+  { dec_5_7_3, enc_5_7_3 }, //   2 OCF 0x02 cmd
+  { dec_5_19_2, enc_5_19_2 }, //   3 OCF 0x02 ret
+  { dec_5_7_3, enc_5_7_3 }, //   4 OCF 0x03 cmd
+  { dec_5_15_2, enc_5_15_2 }, //   5 OCF 0x03 ret
+  { dec_5_7_3, enc_5_7_3 }, //   6 OCF 0x05 cmd
+  { dec_5_15_2, enc_5_15_2 }, //   7 OCF 0x05 ret
+  { dec_5_7_3, enc_5_7_3 }, //   8 OCF 0x06 cmd
+  { dec_5_10_2, enc_5_10_2 }, //   9 OCF 0x06 ret
+  { dec_5_7_3, enc_5_7_3 }, //  10 OCF 0x07 cmd
+  { dec_5_12_3, enc_5_12_3 }, //  11 OCF 0x07 ret
+  { dec_5_7_3, enc_5_7_3 }, //  12 OCF 0x08 cmd
+  { dec_5_15_2, enc_5_15_2 }, //  13 OCF 0x08 ret
+  { dec_5_0_2, enc_5_0_2 }, //  14 OCF 0x0c cmd
+  { dec_5_2_5, enc_5_2_5 }, //  15 OCF 0x0c ret
+  { dec_5_21_3, enc_5_21_3 }, //  16 OCF 0x0d cmd
+  { dec_5_10_1, enc_5_10_1 }, //  17 OCF 0x0d ret
+};
+
+static const CodecFun_t CFun_6[10] = {
+  { dec_6_3_2, enc_6_3_2 }, //   0 OCF 0x01 cmd
+  { dec_6_5_1, enc_6_5_1 }, //   1 OCF 0x01 ret
+  { dec_6_6_3, enc_6_6_3 }, //   2 OCF 0x02 cmd
+  { dec_6_2_1, enc_6_2_1 }, //   3 OCF 0x02 ret
+  { dec_6_0_2, enc_6_0_2 }, //   4 OCF 0x03 cmd
+  { dec_6_2_1, enc_6_2_1 }, //   5 OCF 0x03 ret
+  { dec_6_6_3, enc_6_6_3 }, //   6 OCF 0x04 cmd
+  { dec_6_2_1, enc_6_2_1 }, //   7 OCF 0x04 ret
+  { dec_6_9_3, enc_6_9_3 }, //   8 OCF 0x0a cmd
+  { dec_6_12_2, enc_6_12_2 }, //   9 OCF 0x0a ret
+};
+
+static const CodecFun_t CFun_8[242] = {
+  { dec_8_6_3, enc_8_6_3 }, //   0 OCF 0x01 cmd
+  { dec_8_5_1, enc_8_5_1 }, //   1 OCF 0x01 ret
+  { dec_8_3_2, enc_8_3_2 }, //   2 OCF 0x02 cmd
+  { dec_8_110_2, enc_8_110_2 }, //   3 OCF 0x02 ret
+  { dec_8_3_2, enc_8_3_2 }, //   4 OCF 0x03 cmd
+  { dec_8_32_1, enc_8_32_1 }, //   5 OCF 0x03 ret
+  { dec_8_107_3, enc_8_107_3 }, //   6 OCF 0x05 cmd
+  { dec_8_5_1, enc_8_5_1 }, //   7 OCF 0x05 ret
+  { dec_8_131_3, enc_8_131_3 }, //   8 OCF 0x06 cmd
+  { dec_8_5_1, enc_8_5_1 }, //   9 OCF 0x06 ret
+  { dec_8_3_2, enc_8_3_2 }, //  10 OCF 0x07 cmd
+  { dec_8_8_1, enc_8_8_1 }, //  11 OCF 0x07 ret
+  { dec_8_55_5, enc_8_55_5 }, //  12 OCF 0x08 cmd
+  { dec_8_5_1, enc_8_5_1 }, //  13 OCF 0x08 ret
+  { dec_8_55_5, enc_8_55_5 }, //  14 OCF 0x09 cmd
+  { dec_8_5_1, enc_8_5_1 }, //  15 OCF 0x09 ret
+  { dec_8_14_3, enc_8_14_3 }, //  16 OCF 0x0a cmd
+  { dec_8_5_1, enc_8_5_1 }, //  17 OCF 0x0a ret
+  { dec_8_203_4, enc_8_203_4 }, //  18 OCF 0x0b cmd
+  { dec_8_5_1, enc_8_5_1 }, //  19 OCF 0x0b ret
+  { dec_8_89_3, enc_8_89_3 }, //  20 OCF 0x0c cmd
+  { dec_8_5_1, enc_8_5_1 }, //  21 OCF 0x0c ret
+  { dec_8_46_4, enc_8_46_4 }, //  22 OCF 0x0d cmd
+  { dec_8_3_2, enc_8_3_2 }, //  23 OCF 0x0e cmd
+  { dec_8_5_1, enc_8_5_1 }, //  24 OCF 0x0e ret
+  { dec_8_3_2, enc_8_3_2 }, //  25 OCF 0x0f cmd
+  { dec_8_8_1, enc_8_8_1 }, //  26 OCF 0x0f ret
+  { dec_8_3_2, enc_8_3_2 }, //  27 OCF 0x10 cmd
+  { dec_8_5_1, enc_8_5_1 }, //  28 OCF 0x10 ret
+  { dec_8_3_3, enc_8_3_3 }, //  29 OCF 0x11 cmd
+  { dec_8_5_1, enc_8_5_1 }, //  30 OCF 0x11 ret
+  { dec_8_3_3, enc_8_3_3 }, //  31 OCF 0x12 cmd
+  { dec_8_5_1, enc_8_5_1 }, //  32 OCF 0x12 ret
+  { dec_8_26_3, enc_8_26_3 }, //  33 OCF 0x13 cmd
+  { dec_8_104_3, enc_8_104_3 }, //  34 OCF 0x14 cmd
+  { dec_8_5_1, enc_8_5_1 }, //  35 OCF 0x14 ret
+  { dec_8_89_3, enc_8_89_3 }, //  36 OCF 0x15 cmd
+  { dec_8_113_2, enc_8_113_2 }, //  37 OCF 0x15 ret
+  { dec_8_89_3, enc_8_89_3 }, //  38 OCF 0x16 cmd
+  { dec_8_55_5, enc_8_55_5 }, //  39 OCF 0x17 cmd
+  { dec_8_60_3, enc_8_60_3 }, //  40 OCF 0x17 ret
+  { dec_8_3_2, enc_8_3_2 }, //  41 OCF 0x18 cmd
+  { dec_8_32_1, enc_8_32_1 }, //  42 OCF 0x18 ret
+  { dec_8_50_5, enc_8_50_5 }, //  43 OCF 0x19 cmd
+  { dec_8_95_5, enc_8_95_5 }, //  44 OCF 0x1a cmd
+  { dec_8_24_2, enc_8_24_2 }, //  45 OCF 0x1a ret
+  { dec_8_89_3, enc_8_89_3 }, //  46 OCF 0x1b cmd
+  { dec_8_24_2, enc_8_24_2 }, //  47 OCF 0x1b ret
+  { dec_8_3_2, enc_8_3_2 }, //  48 OCF 0x1c cmd
+  { dec_8_5_1, enc_8_5_1 }, //  49 OCF 0x1c ret
+  { dec_8_14_3, enc_8_14_3 }, //  50 OCF 0x1d cmd
+  { dec_8_5_1, enc_8_5_1 }, //  51 OCF 0x1d ret
+  { dec_8_20_3, enc_8_20_3 }, //  52 OCF 0x1e cmd
+  { dec_8_5_1, enc_8_5_1 }, //  53 OCF 0x1e ret
+  { dec_8_3_2, enc_8_3_2 }, //  54 OCF 0x1f cmd
+  { dec_8_24_2, enc_8_24_2 }, //  55 OCF 0x1f ret
+  { dec_8_26_3, enc_8_26_3 }, //  56 OCF 0x20 cmd
+  { dec_8_24_2, enc_8_24_2 }, //  57 OCF 0x20 ret
+  { dec_8_20_3, enc_8_20_3 }, //  58 OCF 0x21 cmd
+  { dec_8_24_2, enc_8_24_2 }, //  59 OCF 0x21 ret
+  { dec_8_107_3, enc_8_107_3 }, //  60 OCF 0x22 cmd
+  { dec_8_24_2, enc_8_24_2 }, //  61 OCF 0x22 ret
+  { dec_8_3_2, enc_8_3_2 }, //  62 OCF 0x23 cmd
+  { dec_8_124_2, enc_8_124_2 }, //  63 OCF 0x23 ret
+  { dec_8_156_3, enc_8_156_3 }, //  64 OCF 0x24 cmd
+  { dec_8_5_1, enc_8_5_1 }, //  65 OCF 0x24 ret
+  { dec_8_3_2, enc_8_3_2 }, //  66 OCF 0x25 cmd
+  { dec_8_84_5, enc_8_84_5 }, //  67 OCF 0x26 cmd
+  { dec_8_9_5, enc_8_9_5 }, //  68 OCF 0x27 cmd
+  { dec_8_5_1, enc_8_5_1 }, //  69 OCF 0x27 ret
+  { dec_8_3_3, enc_8_3_3 }, //  70 OCF 0x28 cmd
+  { dec_8_5_1, enc_8_5_1 }, //  71 OCF 0x28 ret
+  { dec_8_3_2, enc_8_3_2 }, //  72 OCF 0x29 cmd
+  { dec_8_5_1, enc_8_5_1 }, //  73 OCF 0x29 ret
+  { dec_8_3_2, enc_8_3_2 }, //  74 OCF 0x2a cmd
+  { dec_8_8_1, enc_8_8_1 }, //  75 OCF 0x2a ret
+  { dec_8_3_3, enc_8_3_3 }, //  76 OCF 0x2b cmd
+  { dec_8_48_1, enc_8_48_1 }, //  77 OCF 0x2b ret
+  { dec_8_3_3, enc_8_3_3 }, //  78 OCF 0x2c cmd
+  { dec_8_48_1, enc_8_48_1 }, //  79 OCF 0x2c ret
+  { dec_8_14_3, enc_8_14_3 }, //  80 OCF 0x2d cmd
+  { dec_8_5_1, enc_8_5_1 }, //  81 OCF 0x2d ret
+  { dec_8_89_3, enc_8_89_3 }, //  82 OCF 0x2e cmd
+  { dec_8_5_1, enc_8_5_1 }, //  83 OCF 0x2e ret
+  { dec_8_3_2, enc_8_3_2 }, //  84 OCF 0x2f cmd
+  { dec_8_122_2, enc_8_122_2 }, //  85 OCF 0x2f ret
+  { dec_8_89_3, enc_8_89_3 }, //  86 OCF 0x30 cmd
+  { dec_8_124_2, enc_8_124_2 }, //  87 OCF 0x30 ret
+  { dec_8_20_3, enc_8_20_3 }, //  88 OCF 0x31 cmd
+  { dec_8_5_1, enc_8_5_1 }, //  89 OCF 0x31 ret
+  { dec_8_222_4, enc_8_222_4 }, //  90 OCF 0x32 cmd
+  { dec_8_20_3, enc_8_20_3 }, //  91 OCF 0x33 cmd
+  { dec_8_5_1, enc_8_5_1 }, //  92 OCF 0x33 ret
+  { dec_8_156_3, enc_8_156_3 }, //  93 OCF 0x34 cmd
+  { dec_8_5_1, enc_8_5_1 }, //  94 OCF 0x34 ret
+  { dec_8_3_3, enc_8_3_3 }, //  95 OCF 0x35 cmd
+  { dec_8_5_1, enc_8_5_1 }, //  96 OCF 0x35 ret
+  { dec_8_183_6, enc_8_183_6 }, //  97 OCF 0x36 cmd
+  { dec_8_8_1, enc_8_8_1 }, //  98 OCF 0x36 ret
+  { dec_8_156_4, enc_8_156_4 }, //  99 OCF 0x37 cmd
+  { dec_8_5_1, enc_8_5_1 }, // 100 OCF 0x37 ret
+  { dec_8_156_4, enc_8_156_4 }, // 101 OCF 0x38 cmd
+  { dec_8_5_1, enc_8_5_1 }, // 102 OCF 0x38 ret
+  { dec_8_170_7, enc_8_170_7 }, // 103 OCF 0x39 cmd
+  { dec_8_5_1, enc_8_5_1 }, // 104 OCF 0x39 ret
+  { dec_8_3_2, enc_8_3_2 }, // 105 OCF 0x3a cmd
+  { dec_8_24_2, enc_8_24_2 }, // 106 OCF 0x3a ret
+  { dec_8_3_2, enc_8_3_2 }, // 107 OCF 0x3b cmd
+  { dec_8_8_1, enc_8_8_1 }, // 108 OCF 0x3b ret
+  { dec_8_14_3, enc_8_14_3 }, // 109 OCF 0x3c cmd
+  { dec_8_5_1, enc_8_5_1 }, // 110 OCF 0x3c ret
+  { dec_8_3_2, enc_8_3_2 }, // 111 OCF 0x3d cmd
+  { dec_8_5_1, enc_8_5_1 }, // 112 OCF 0x3d ret
+  { dec_8_203_4, enc_8_203_4 }, // 113 OCF 0x3e cmd
+  { dec_8_5_1, enc_8_5_1 }, // 114 OCF 0x3e ret
+  { dec_8_195_4, enc_8_195_4 }, // 115 OCF 0x3f cmd
+  { dec_8_5_1, enc_8_5_1 }, // 116 OCF 0x3f ret
+  { dec_8_89_3, enc_8_89_3 }, // 117 OCF 0x40 cmd
+  { dec_8_5_1, enc_8_5_1 }, // 118 OCF 0x40 ret
+  { dec_8_189_6, enc_8_189_6 }, // 119 OCF 0x41 cmd
+  { dec_8_5_1, enc_8_5_1 }, // 120 OCF 0x41 ret
+  { dec_8_107_3, enc_8_107_3 }, // 121 OCF 0x42 cmd
+  { dec_8_5_1, enc_8_5_1 }, // 122 OCF 0x42 ret
+  { dec_8_72_7, enc_8_72_7 }, // 123 OCF 0x43 cmd
+  { dec_8_100_4, enc_8_100_4 }, // 124 OCF 0x44 cmd
+  { dec_8_3_2, enc_8_3_2 }, // 125 OCF 0x45 cmd
+  { dec_8_5_1, enc_8_5_1 }, // 126 OCF 0x45 ret
+  { dec_8_89_3, enc_8_89_3 }, // 127 OCF 0x46 cmd
+  { dec_8_5_1, enc_8_5_1 }, // 128 OCF 0x46 ret
+  { dec_8_6_3, enc_8_6_3 }, // 129 OCF 0x47 cmd
+  { dec_8_5_1, enc_8_5_1 }, // 130 OCF 0x47 ret
+  { dec_8_6_3, enc_8_6_3 }, // 131 OCF 0x48 cmd
+  { dec_8_5_1, enc_8_5_1 }, // 132 OCF 0x48 ret
+  { dec_8_3_2, enc_8_3_2 }, // 133 OCF 0x49 cmd
+  { dec_8_5_1, enc_8_5_1 }, // 134 OCF 0x49 ret
+  { dec_8_3_2, enc_8_3_2 }, // 135 OCF 0x4a cmd
+  { dec_8_8_1, enc_8_8_1 }, // 136 OCF 0x4a ret
+  { dec_8_3_2, enc_8_3_2 }, // 137 OCF 0x4b cmd
+  { dec_8_36_1, enc_8_36_1 }, // 138 OCF 0x4b ret
+  { dec_8_3_2, enc_8_3_2 }, // 139 OCF 0x4c cmd
+  { dec_8_124_2, enc_8_124_2 }, // 140 OCF 0x4c ret
+  { dec_8_156_3, enc_8_156_3 }, // 141 OCF 0x4d cmd
+  { dec_8_5_1, enc_8_5_1 }, // 142 OCF 0x4d ret
+  { dec_8_6_3, enc_8_6_3 }, // 143 OCF 0x4e cmd
+  { dec_8_5_1, enc_8_5_1 }, // 144 OCF 0x4e ret
+  { dec_8_126_5, enc_8_126_5 }, // 145 OCF 0x4f cmd
+  { dec_8_5_1, enc_8_5_1 }, // 146 OCF 0x4f ret
+  { dec_8_126_5, enc_8_126_5 }, // 147 OCF 0x50 cmd
+  { dec_8_5_1, enc_8_5_1 }, // 148 OCF 0x50 ret
+  { dec_8_151_5, enc_8_151_5 }, // 149 OCF 0x51 cmd
+  { dec_8_5_1, enc_8_5_1 }, // 150 OCF 0x51 ret
+  { dec_8_89_3, enc_8_89_3 }, // 151 OCF 0x52 cmd
+  { dec_8_5_1, enc_8_5_1 }, // 152 OCF 0x52 ret
+  { dec_8_161_5, enc_8_161_5 }, // 153 OCF 0x53 cmd
+  { dec_8_24_2, enc_8_24_2 }, // 154 OCF 0x53 ret
+  { dec_8_151_5, enc_8_151_5 }, // 155 OCF 0x54 cmd
+  { dec_8_24_2, enc_8_24_2 }, // 156 OCF 0x54 ret
+  { dec_8_156_5, enc_8_156_5 }, // 157 OCF 0x55 cmd
+  { dec_8_24_2, enc_8_24_2 }, // 158 OCF 0x55 ret
+  { dec_8_20_4, enc_8_20_4 }, // 159 OCF 0x56 cmd
+  { dec_8_24_2, enc_8_24_2 }, // 160 OCF 0x56 ret
+  { dec_8_20_3, enc_8_20_3 }, // 161 OCF 0x57 cmd
+  { dec_8_24_2, enc_8_24_2 }, // 162 OCF 0x57 ret
+  { dec_8_3_2, enc_8_3_2 }, // 163 OCF 0x58 cmd
+  { dec_8_38_1, enc_8_38_1 }, // 164 OCF 0x58 ret
+  { dec_8_20_3, enc_8_20_3 }, // 165 OCF 0x59 cmd
+  { dec_8_5_1, enc_8_5_1 }, // 166 OCF 0x59 ret
+  { dec_8_107_3, enc_8_107_3 }, // 167 OCF 0x5a cmd
+  { dec_8_24_2, enc_8_24_2 }, // 168 OCF 0x5a ret
+  { dec_8_104_3, enc_8_104_3 }, // 169 OCF 0x5b cmd
+  { dec_8_24_2, enc_8_24_2 }, // 170 OCF 0x5b ret
+  { dec_8_218_4, enc_8_218_4 }, // 171 OCF 0x5c cmd
+  { dec_8_24_2, enc_8_24_2 }, // 172 OCF 0x5c ret
+  { dec_8_166_4, enc_8_166_4 }, // 173 OCF 0x5d cmd
+  { dec_8_5_1, enc_8_5_1 }, // 174 OCF 0x5d ret
+  { dec_8_79_5, enc_8_79_5 }, // 175 OCF 0x5e cmd
+  { dec_8_14_3, enc_8_14_3 }, // 176 OCF 0x5f cmd
+  { dec_8_5_1, enc_8_5_1 }, // 177 OCF 0x5f ret
+  { dec_8_3_2, enc_8_3_2 }, // 178 OCF 0x60 cmd
+  { dec_8_110_3, enc_8_110_3 }, // 179 OCF 0x60 ret
+  { dec_8_89_3, enc_8_89_3 }, // 180 OCF 0x61 cmd
+  { dec_8_120_2, enc_8_120_2 }, // 181 OCF 0x61 ret
+  { dec_8_134_7, enc_8_134_7 }, // 182 OCF 0x62 cmd
+  { dec_8_141_3, enc_8_141_3 }, // 183 OCF 0x62 ret
+  { dec_8_144_7, enc_8_144_7 }, // 184 OCF 0x63 cmd
+  { dec_8_141_3, enc_8_141_3 }, // 185 OCF 0x63 ret
+  { dec_8_40_6, enc_8_40_6 }, // 186 OCF 0x64 cmd
+  { dec_8_14_3, enc_8_14_3 }, // 187 OCF 0x65 cmd
+  { dec_8_8_1, enc_8_8_1 }, // 188 OCF 0x65 ret
+  { dec_8_0_3, enc_8_0_3 }, // 189 OCF 0x66 cmd
+  { dec_8_20_3, enc_8_20_3 }, // 190 OCF 0x67 cmd
+  { dec_8_24_2, enc_8_24_2 }, // 191 OCF 0x67 ret
+  { dec_8_29_5, enc_8_29_5 }, // 192 OCF 0x68 cmd
+  { dec_8_34_6, enc_8_34_6 }, // 193 OCF 0x69 cmd
+  { dec_8_89_3, enc_8_89_3 }, // 194 OCF 0x6a cmd
+  { dec_8_14_6, enc_8_14_6 }, // 195 OCF 0x6b cmd
+  { dec_8_14_3, enc_8_14_3 }, // 196 OCF 0x6c cmd
+  { dec_8_8_1, enc_8_8_1 }, // 197 OCF 0x6c ret
+  { dec_8_89_3, enc_8_89_3 }, // 198 OCF 0x6d cmd
+  { dec_8_226_4, enc_8_226_4 }, // 199 OCF 0x6e cmd
+  { dec_8_24_2, enc_8_24_2 }, // 200 OCF 0x6e ret
+  { dec_8_20_3, enc_8_20_3 }, // 201 OCF 0x6f cmd
+  { dec_8_24_2, enc_8_24_2 }, // 202 OCF 0x6f ret
+  { dec_8_20_3, enc_8_20_3 }, // 203 OCF 0x70 cmd
+  { dec_8_24_2, enc_8_24_2 }, // 204 OCF 0x70 ret
+  { dec_8_20_3, enc_8_20_3 }, // 205 OCF 0x71 cmd
+  { dec_8_24_2, enc_8_24_2 }, // 206 OCF 0x71 ret
+  { dec_8_89_3, enc_8_89_3 }, // 207 OCF 0x72 cmd
+  { dec_8_92_3, enc_8_92_3 }, // 208 OCF 0x72 ret
+  { dec_8_89_3, enc_8_89_3 }, // 209 OCF 0x73 cmd
+  { dec_8_92_3, enc_8_92_3 }, // 210 OCF 0x73 ret
+  { dec_8_89_3, enc_8_89_3 }, // 211 OCF 0x74 cmd
+  { dec_8_5_1, enc_8_5_1 }, // 212 OCF 0x74 ret
+  { dec_8_89_3, enc_8_89_3 }, // 213 OCF 0x75 cmd
+  { dec_8_115_5, enc_8_115_5 }, // 214 OCF 0x75 ret
+  { dec_8_20_3, enc_8_20_3 }, // 215 OCF 0x76 cmd
+  { dec_8_63_2, enc_8_63_2 }, // 216 OCF 0x76 ret
+  { dec_8_20_3, enc_8_20_3 }, // 217 OCF 0x77 cmd
+  { dec_8_6_3, enc_8_6_3 }, // 218 OCF 0x78 cmd
+  { dec_8_24_2, enc_8_24_2 }, // 219 OCF 0x78 ret
+  { dec_8_20_3, enc_8_20_3 }, // 220 OCF 0x79 cmd
+  { dec_8_24_2, enc_8_24_2 }, // 221 OCF 0x79 ret
+  { dec_8_156_3, enc_8_156_3 }, // 222 OCF 0x7a cmd
+  { dec_8_24_2, enc_8_24_2 }, // 223 OCF 0x7a ret
+  { dec_8_230_5, enc_8_230_5 }, // 224 OCF 0x7b cmd
+  { dec_8_5_1, enc_8_5_1 }, // 225 OCF 0x7b ret
+  { dec_8_89_3, enc_8_89_3 }, // 226 OCF 0x7c cmd
+  { dec_8_5_1, enc_8_5_1 }, // 227 OCF 0x7c ret
+  { dec_8_72_3, enc_8_72_3 }, // 228 OCF 0x7d cmd
+  { dec_8_5_1, enc_8_5_1 }, // 229 OCF 0x7d ret
+  { dec_8_65_3, enc_8_65_3 }, // 230 OCF 0x7e cmd
+  { dec_8_177_6, enc_8_177_6 }, // 231 OCF 0x7f cmd
+  { dec_8_8_1, enc_8_8_1 }, // 232 OCF 0x7f ret
+  { dec_8_211_7, enc_8_211_7 }, // 233 OCF 0x82 cmd
+  { dec_8_8_1, enc_8_8_1 }, // 234 OCF 0x82 ret
+  { dec_8_207_4, enc_8_207_4 }, // 235 OCF 0x83 cmd
+  { dec_8_24_2, enc_8_24_2 }, // 236 OCF 0x83 ret
+  { dec_8_151_5, enc_8_151_5 }, // 237 OCF 0x84 cmd
+  { dec_8_24_2, enc_8_24_2 }, // 238 OCF 0x84 ret
+  { dec_8_65_7, enc_8_65_7 }, // 239 OCF 0x85 cmd
+  { dec_8_199_4, enc_8_199_4 }, // 240 OCF 0x86 cmd
+  { dec_8_8_1, enc_8_8_1 }, // 241 OCF 0x86 ret
+};
+
+const CodecFun_t * const cfuns[9] = {
+  CFun_0,
+  CFun_1,
+  CFun_2,
+  CFun_3,
+  CFun_4,
+  CFun_5,
+  CFun_6,
+  NULL,
+  CFun_8
+};
@@ -0,0 +1,421 @@
+// Copyright 2024 Steven Buytaert
+
+// Generated direct index tables by hci-coi2c.c; do not edit.
+
+#include <stddef.h>
+#include <codec-int.h>
+
+// [event code or OCF][issub or isret] gives the table element index + 1; 0 when not there.
+
+static const uint8_t Idx_0[90][2] = {
+  [0x01] = {   1,   2 },
+  [0x02] = {   3,   4 },
+  [0x03] = {   5,   6 },
+  [0x04] = {   7,   8 },
+  [0x05] = {   9,  10 },
+  [0x06] = {  11,  12 },
+  [0x07] = {  13,  14 },
+  [0x08] = {  15,  16 },
+  [0x09] = {  17,  18 },
+  [0x0a] = {  19,  20 },
+  [0x0b] = {  21,  22 },
+  [0x0c] = {  23,  24 },
+  [0x0d] = {  25,  26 },
+  [0x0e] = {  27,  28 },
+  [0x0f] = {  29,  30 },
+  [0x10] = {  31,  32 },
+  [0x11] = {  33,  34 },
+  [0x12] = {  35,  36 },
+  [0x13] = {  37,  38 },
+  [0x14] = {  39,  40 },
+  [0x15] = {  41,  42 },
+  [0x16] = {  43,  44 },
+  [0x17] = {  45,  46 },
+  [0x18] = {  47,  48 },
+  [0x19] = {  49,  50 },
+  [0x1a] = {  51,  52 },
+  [0x1b] = {  53,  54 },
+  [0x1c] = {  55,  56 },
+  [0x1d] = {  57,  58 },
+  [0x1e] = {  59,  60 },
+  [0x1f][1] =  61,
+  [0x20] = {  62,  63 },
+  [0x21] = {  64,  65 },
+  [0x22] = {  66,  67 },
+  [0x23] = {  68,  69 },
+  [0x24][1] =  70,
+  [0x25][1] =  71,
+  [0x26][1] =  72,
+  [0x27][1] =  73,
+  [0x28][1] =  74,
+  [0x29][1] =  75,
+  [0x2c][0] =  76,
+  [0x2d][0] =  77,
+  [0x2e][0] =  78,
+  [0x2f][0] =  79,
+  [0x30][0] =  80,
+  [0x31][0] =  81,
+  [0x32][0] =  82,
+  [0x33][0] =  83,
+  [0x34][0] =  84,
+  [0x35][0] =  85,
+  [0x36][0] =  86,
+  [0x38][0] =  87,
+  [0x39][0] =  88,
+  [0x3b][0] =  89,
+  [0x3c][0] =  90,
+  [0x3d][0] =  91,
+  [0x48][0] =  92,
+  [0x4e][0] =  93,
+  [0x4f][0] =  94,
+  [0x50][0] =  95,
+  [0x51][0] =  96,
+  [0x52][0] =  97,
+  [0x53][0] =  98,
+  [0x55][0] =  99,
+  [0x56][0] = 100,
+  [0x57][0] = 101,
+  [0x58][0] = 102,
+  [0x59][0] = 103,
+};
+
+static const uint8_t Idx_1[70][2] = {
+  [0x01][0] =   1,
+  [0x02] = {   2,   3 },
+  [0x03] = {   4,   5 },
+  [0x04] = {   6,   7 },
+  [0x05][0] =   8,
+  [0x06][0] =   9,
+  [0x08] = {  10,  11 },
+  [0x09][0] =  12,
+  [0x0a][0] =  13,
+  [0x0b] = {  14,  15 },
+  [0x0c] = {  16,  17 },
+  [0x0d] = {  18,  19 },
+  [0x0e] = {  20,  21 },
+  [0x0f][0] =  22,
+  [0x11][0] =  23,
+  [0x13][0] =  24,
+  [0x15][0] =  25,
+  [0x17][0] =  26,
+  [0x19][0] =  27,
+  [0x1a] = {  28,  29 },
+  [0x1b][0] =  30,
+  [0x1c][0] =  31,
+  [0x1d][0] =  32,
+  [0x1f][0] =  33,
+  [0x20] = {  34,  35 },
+  [0x28][0] =  36,
+  [0x29][0] =  37,
+  [0x2a][0] =  38,
+  [0x2b] = {  39,  40 },
+  [0x2c] = {  41,  42 },
+  [0x2d] = {  43,  44 },
+  [0x2e] = {  45,  46 },
+  [0x2f] = {  47,  48 },
+  [0x30] = {  49,  50 },
+  [0x33] = {  51,  52 },
+  [0x34] = {  53,  54 },
+  [0x3d][0] =  55,
+  [0x3e][0] =  56,
+  [0x3f][0] =  57,
+  [0x40] = {  58,  59 },
+  [0x41] = {  60,  61 },
+  [0x42] = {  62,  63 },
+  [0x43][0] =  64,
+  [0x44][0] =  65,
+  [0x45] = {  66,  67 },
+};
+
+static const uint8_t Idx_2[18][2] = {
+  [0x01][0] =   1,
+  [0x03][0] =   2,
+  [0x04][0] =   3,
+  [0x07][0] =   4,
+  [0x09] = {   5,   6 },
+  [0x0b][0] =   7,
+  [0x0c] = {   8,   9 },
+  [0x0d] = {  10,  11 },
+  [0x0e] = {  12,  13 },
+  [0x0f] = {  14,  15 },
+  [0x10][0] =  16,
+  [0x11] = {  17,  18 },
+};
+
+static const uint8_t Idx_3[133][2] = {
+  [0x01] = {   1,   2 },
+  [0x03] = {   3,   4 },
+  [0x05] = {   5,   6 },
+  [0x08] = {   7,   8 },
+  [0x09] = {   9,  10 },
+  [0x0a] = {  11,  12 },
+  [0x0d] = {  13,  14 },
+  [0x11] = {  15,  16 },
+  [0x12] = {  17,  18 },
+  [0x13] = {  19,  20 },
+  [0x14] = {  21,  22 },
+  [0x15] = {  23,  24 },
+  [0x16] = {  25,  26 },
+  [0x17] = {  27,  28 },
+  [0x18] = {  29,  30 },
+  [0x19] = {  31,  32 },
+  [0x1a] = {  33,  34 },
+  [0x1b] = {  35,  36 },
+  [0x1c] = {  37,  38 },
+  [0x1d] = {  39,  40 },
+  [0x1e] = {  41,  42 },
+  [0x1f] = {  43,  44 },
+  [0x20] = {  45,  46 },
+  [0x23] = {  47,  48 },
+  [0x24] = {  49,  50 },
+  [0x25] = {  51,  52 },
+  [0x26] = {  53,  54 },
+  [0x27] = {  55,  56 },
+  [0x28] = {  57,  58 },
+  [0x29] = {  59,  60 },
+  [0x2a] = {  61,  62 },
+  [0x2b] = {  63,  64 },
+  [0x2c] = {  65,  66 },
+  [0x2d] = {  67,  68 },
+  [0x2e] = {  69,  70 },
+  [0x2f] = {  71,  72 },
+  [0x31] = {  73,  74 },
+  [0x33] = {  75,  76 },
+  [0x35][0] =  77,
+  [0x36] = {  78,  79 },
+  [0x37] = {  80,  81 },
+  [0x38] = {  82,  83 },
+  [0x39] = {  84,  85 },
+  [0x3a] = {  86,  87 },
+  [0x3f] = {  88,  89 },
+  [0x42] = {  90,  91 },
+  [0x43] = {  92,  93 },
+  [0x44] = {  94,  95 },
+  [0x45] = {  96,  97 },
+  [0x46] = {  98,  99 },
+  [0x47] = { 100, 101 },
+  [0x48] = { 102, 103 },
+  [0x49] = { 104, 105 },
+  [0x51] = { 106, 107 },
+  [0x52] = { 108, 109 },
+  [0x53][0] = 110,
+  [0x55] = { 111, 112 },
+  [0x56] = { 113, 114 },
+  [0x57] = { 115, 116 },
+  [0x58] = { 117, 118 },
+  [0x59] = { 119, 120 },
+  [0x5a] = { 121, 122 },
+  [0x5b] = { 123, 124 },
+  [0x5f][0] = 125,
+  [0x60] = { 126, 127 },
+  [0x63] = { 128, 129 },
+  [0x66] = { 130, 131 },
+  [0x67] = { 132, 133 },
+  [0x68] = { 134, 135 },
+  [0x6c] = { 136, 137 },
+  [0x6d] = { 138, 139 },
+  [0x6e] = { 140, 141 },
+  [0x6f] = { 142, 143 },
+  [0x70] = { 144, 145 },
+  [0x71] = { 146, 147 },
+  [0x72] = { 148, 149 },
+  [0x73] = { 150, 151 },
+  [0x74] = { 152, 153 },
+  [0x75] = { 154, 155 },
+  [0x76] = { 156, 157 },
+  [0x77] = { 158, 159 },
+  [0x78] = { 160, 161 },
+  [0x79] = { 162, 163 },
+  [0x7a] = { 164, 165 },
+  [0x7b] = { 166, 167 },
+  [0x7c] = { 168, 169 },
+  [0x7d] = { 170, 171 },
+  [0x7e] = { 172, 173 },
+  [0x7f] = { 174, 175 },
+  [0x80] = { 176, 177 },
+  [0x81] = { 178, 179 },
+  [0x82] = { 180, 181 },
+  [0x83] = { 182, 183 },
+  [0x84] = { 184, 185 },
+};
+
+static const uint8_t Idx_4[16][2] = {
+  [0x01] = {   1,   2 },
+  [0x02] = {   3,   4 },
+  [0x03] = {   5,   6 },
+  [0x04] = {   7,   8 },
+  [0x05] = {   9,  10 },
+  [0x09] = {  11,  12 },
+  [0x0a] = {  13,  14 },
+  [0x0b] = {  15,  16 },
+  [0x0c] = {  17,  18 },
+  [0x0d] = {  19,  20 },
+  [0x0e] = {  21,  22 },
+  [0x0f] = {  23,  24 },
+};
+
+static const uint8_t Idx_5[14][2] = {
+  [0x01] = {   1,   2 },
+  [0x02] = {   3,   4 },
+  [0x03] = {   5,   6 },
+  [0x05] = {   7,   8 },
+  [0x06] = {   9,  10 },
+  [0x07] = {  11,  12 },
+  [0x08] = {  13,  14 },
+  [0x0c] = {  15,  16 },
+  [0x0d] = {  17,  18 },
+};
+
+static const uint8_t Idx_6[11][2] = {
+  [0x01] = {   1,   2 },
+  [0x02] = {   3,   4 },
+  [0x03] = {   5,   6 },
+  [0x04] = {   7,   8 },
+  [0x0a] = {   9,  10 },
+};
+
+static const uint8_t Idx_8[135][2] = {
+  [0x01] = {   1,   2 },
+  [0x02] = {   3,   4 },
+  [0x03] = {   5,   6 },
+  [0x05] = {   7,   8 },
+  [0x06] = {   9,  10 },
+  [0x07] = {  11,  12 },
+  [0x08] = {  13,  14 },
+  [0x09] = {  15,  16 },
+  [0x0a] = {  17,  18 },
+  [0x0b] = {  19,  20 },
+  [0x0c] = {  21,  22 },
+  [0x0d][0] =  23,
+  [0x0e] = {  24,  25 },
+  [0x0f] = {  26,  27 },
+  [0x10] = {  28,  29 },
+  [0x11] = {  30,  31 },
+  [0x12] = {  32,  33 },
+  [0x13][0] =  34,
+  [0x14] = {  35,  36 },
+  [0x15] = {  37,  38 },
+  [0x16][0] =  39,
+  [0x17] = {  40,  41 },
+  [0x18] = {  42,  43 },
+  [0x19][0] =  44,
+  [0x1a] = {  45,  46 },
+  [0x1b] = {  47,  48 },
+  [0x1c] = {  49,  50 },
+  [0x1d] = {  51,  52 },
+  [0x1e] = {  53,  54 },
+  [0x1f] = {  55,  56 },
+  [0x20] = {  57,  58 },
+  [0x21] = {  59,  60 },
+  [0x22] = {  61,  62 },
+  [0x23] = {  63,  64 },
+  [0x24] = {  65,  66 },
+  [0x25][0] =  67,
+  [0x26][0] =  68,
+  [0x27] = {  69,  70 },
+  [0x28] = {  71,  72 },
+  [0x29] = {  73,  74 },
+  [0x2a] = {  75,  76 },
+  [0x2b] = {  77,  78 },
+  [0x2c] = {  79,  80 },
+  [0x2d] = {  81,  82 },
+  [0x2e] = {  83,  84 },
+  [0x2f] = {  85,  86 },
+  [0x30] = {  87,  88 },
+  [0x31] = {  89,  90 },
+  [0x32][0] =  91,
+  [0x33] = {  92,  93 },
+  [0x34] = {  94,  95 },
+  [0x35] = {  96,  97 },
+  [0x36] = {  98,  99 },
+  [0x37] = { 100, 101 },
+  [0x38] = { 102, 103 },
+  [0x39] = { 104, 105 },
+  [0x3a] = { 106, 107 },
+  [0x3b] = { 108, 109 },
+  [0x3c] = { 110, 111 },
+  [0x3d] = { 112, 113 },
+  [0x3e] = { 114, 115 },
+  [0x3f] = { 116, 117 },
+  [0x40] = { 118, 119 },
+  [0x41] = { 120, 121 },
+  [0x42] = { 122, 123 },
+  [0x43][0] = 124,
+  [0x44][0] = 125,
+  [0x45] = { 126, 127 },
+  [0x46] = { 128, 129 },
+  [0x47] = { 130, 131 },
+  [0x48] = { 132, 133 },
+  [0x49] = { 134, 135 },
+  [0x4a] = { 136, 137 },
+  [0x4b] = { 138, 139 },
+  [0x4c] = { 140, 141 },
+  [0x4d] = { 142, 143 },
+  [0x4e] = { 144, 145 },
+  [0x4f] = { 146, 147 },
+  [0x50] = { 148, 149 },
+  [0x51] = { 150, 151 },
+  [0x52] = { 152, 153 },
+  [0x53] = { 154, 155 },
+  [0x54] = { 156, 157 },
+  [0x55] = { 158, 159 },
+  [0x56] = { 160, 161 },
+  [0x57] = { 162, 163 },
+  [0x58] = { 164, 165 },
+  [0x59] = { 166, 167 },
+  [0x5a] = { 168, 169 },
+  [0x5b] = { 170, 171 },
+  [0x5c] = { 172, 173 },
+  [0x5d] = { 174, 175 },
+  [0x5e][0] = 176,
+  [0x5f] = { 177, 178 },
+  [0x60] = { 179, 180 },
+  [0x61] = { 181, 182 },
+  [0x62] = { 183, 184 },
+  [0x63] = { 185, 186 },
+  [0x64][0] = 187,
+  [0x65] = { 188, 189 },
+  [0x66][0] = 190,
+  [0x67] = { 191, 192 },
+  [0x68][0] = 193,
+  [0x69][0] = 194,
+  [0x6a][0] = 195,
+  [0x6b][0] = 196,
+  [0x6c] = { 197, 198 },
+  [0x6d][0] = 199,
+  [0x6e] = { 200, 201 },
+  [0x6f] = { 202, 203 },
+  [0x70] = { 204, 205 },
+  [0x71] = { 206, 207 },
+  [0x72] = { 208, 209 },
+  [0x73] = { 210, 211 },
+  [0x74] = { 212, 213 },
+  [0x75] = { 214, 215 },
+  [0x76] = { 216, 217 },
+  [0x77][0] = 218,
+  [0x78] = { 219, 220 },
+  [0x79] = { 221, 222 },
+  [0x7a] = { 223, 224 },
+  [0x7b] = { 225, 226 },
+  [0x7c] = { 227, 228 },
+  [0x7d] = { 229, 230 },
+  [0x7e][0] = 231,
+  [0x7f] = { 232, 233 },
+  [0x82] = { 234, 235 },
+  [0x83] = { 236, 237 },
+  [0x84] = { 238, 239 },
+  [0x85][0] = 240,
+  [0x86] = { 241, 242 },
+};
+
+const CodecIdx_t cidx[9] = {
+  { .num =  90, .idx = Idx_0 },
+  { .num =  70, .idx = Idx_1 },
+  { .num =  18, .idx = Idx_2 },
+  { .num = 133, .idx = Idx_3 },
+  { .num =  16, .idx = Idx_4 },
+  { .num =  14, .idx = Idx_5 },
+  { .num =  11, .idx = Idx_6 },
+  { .num =   0, .idx = NULL },
+  { .num = 135, .idx = Idx_8 }
+};
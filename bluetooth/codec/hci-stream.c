@@ -0,0 +1,133 @@
+// Copyright 2024 Steven Buytaert
+
+#include <stddef.h>
+#include <codec-int.h>
+#include <hci-types-5.4.h>
+
+// Decoding an H4 byte stream; see hci-codec.h. It is in a file of its own, so
+// that the codec stays small when it is not used.
+
+extern const CodecFun_t * const cfuns[9] __attribute__((weak));  // NULL unless compiled functions are linked in.
+
+typedef struct Frame_t {          // How to frame a packet of an H4 type.
+  uint8_t               hdr;      // Header size, after the type byte.
+  uint8_t               at;       // Offset of the length in the header.
+  uint8_t               wide;     // Non zero for a 2 byte length.
+  uint8_t               decode;   // Non zero when pkt2struct decodes it.
+} Frame_t;
+
+static const Frame_t Frames[6] = {
+  [type_CMD] = { .hdr = 3, .at = 2, .wide = 0, .decode = 1 },  // OCF|OGF, length.
+  [type_ACL] = { .hdr = 4, .at = 2, .wide = 1, .decode = 0 },  // Handle and flags, length.
+  [type_SYN] = { .hdr = 3, .at = 2, .wide = 0, .decode = 0 },  // Handle and flags, 1 byte length on the wire.
+  [type_EVT] = { .hdr = 2, .at = 1, .wide = 0, .decode = 1 },  // Code, length.
+  [type_ISO] = { .hdr = 4, .at = 2, .wide = 1, .decode = 0 },  // Handle and flags, 14 bit length.
+};
+
+static uint32_t fsize(uint8_t type, const uint8_t hdr[]) {  // Size of the packet, type byte included; header complete.
+
+  const Frame_t * f = & Frames[type];
+  uint32_t        len = hdr[f->at];
+
+  if (f->wide) {
+    len |= (uint32_t) hdr[f->at + 1] << 8;                  // Little endian.
+  }
+
+  if (type_ISO == type) {
+    len &= 0x3fff;                                          // The upper 2 bits are RFU.
+  }
+
+  return 1u + f->hdr + len;
+
+}
+
+uint32_t stream2structs(streamreq_t req) {
+
+  const uint8_t * cur = req->Stream.buf;
+  const uint8_t * end = cur + req->Stream.sz;
+  uint8_t *       arena = req->Arena.buf;
+  uint32_t        left;
+  uint32_t        sz;
+  uint32_t        at;
+  uint32_t        size;
+  StreamPkt_t *   pkt;
+  CodecReq_t      Req;
+  te_t            entry;
+  ctab_t          ctab;
+  uint8_t         ti;
+  const CodecFun_t * cfun;
+
+  req->Stream.used = 0;
+  req->Stream.need = 0;
+  req->Stream.skipped = 0;
+  req->Arena.used = 0;
+  req->Pkts.num = 0;
+
+  while (cur < end && req->Pkts.num < req->Pkts.cap) {
+
+    if (cur[0] > type_ISO || ! Frames[cur[0]].hdr) {        // Not a packet type; skip it.
+      req->Stream.skipped++;
+      cur++;
+      req->Stream.used++;
+      continue;
+    }
+
+    left = (uint32_t) (end - cur);
+
+    if (left < 1u + Frames[cur[0]].hdr) {                   // Partial header.
+      req->Stream.need = 1u + Frames[cur[0]].hdr - left;
+      break;
+    }
+
+    sz = fsize(cur[0], cur + 1);
+
+    if (left < sz) {                                        // Partial packet.
+      req->Stream.need = sz - left;
+      break;
+    }
+
+    pkt = & req->Pkts.buf[req->Pkts.num];
+    pkt->pkt = cur;
+    pkt->str = NULL;
+    pkt->sz = sz;
+    pkt->status = CReq_OK;
+    pkt->rfu = 0;
+
+    if (Frames[cur[0]].decode) {
+      at = (req->Arena.used + 7u) & ~7u;                    // Keep each structure aligned.
+      left = at < req->Arena.sz ? req->Arena.sz - at : 0;
+      if (left > 0xffff) { left = 0xffff; }
+      size = 0;
+      if (cfuns) {                                          // Directly to a compiled decoder, if there is one.
+        entry = codec4dec(cur, & ctab, & ti);
+        cfun = entry && cfuns[ti] ? & cfuns[ti][entry - ctab->table] : NULL;
+        size = cfun && cfun->dec ? cfun->dec(arena + at, left, cur, sz) : 0;
+      }
+      if (! size) {                                         // The whole thing; also for the proper status.
+        Req.Pkt.buf = (uint8_t *) cur;
+        Req.Pkt.sz = (uint16_t) sz;                         // Commands and events are at most 259 bytes.
+        Req.Struct.buf = arena + at;
+        Req.Struct.sz = (uint16_t) left;
+        size = pkt2struct(& Req);
+      }
+      if (size) {
+        pkt->str = arena + at;
+        req->Arena.used = at + size;
+      }
+      else {
+        pkt->status = Req.Pkt.status ? Req.Pkt.status : Req.Struct.status;
+        if (CReq_OOB == Req.Struct.status && req->Arena.used) {
+          break;                                            // Arena full; leave it for the next call.
+        }
+      }
+    }
+
+    req->Pkts.num++;
+    cur += sz;
+    req->Stream.used += sz;
+
+  }
+
+  return req->Pkts.num;
+
+}
@@ -0,0 +1,482 @@
+// Copyright (c) 2020,2021-2025 Steven Buytaert
+
+#define _GNU_SOURCE
+
+#include <circbuffer.h>
+#include <stdio.h>
+#include <getopt.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#include <inttypes.h>
+
+/*
+
+  Throughput benchmark; writer threads stream a number of bytes, in messages
+  of a given size, through a circular buffer to reader threads, that read
+  them in the same message size. With a single writer and reader, both
+  threads can be pinned to a core, so the cost of the index traffic between
+  the cores becomes visible. With -v, each byte carries its stream offset
+  and the readers check it; with more writers, only the offsets within each
+  message can be checked.
+
+  The flavours are
+    - bcb:       Bcb_t with bcb_write/bcb_read; 1 writer and 1 reader only.
+    - slices:    Bcb_t with a loop over bcb_writeslice/memcpy/bcb_produced and
+                 the same for reading, i.e. without the bulk copy path.
+    - scb:       Scb_t with scb_write/scb_read; 1 writer and 1 reader only.
+    - mirror:    Bcb_t in mirrored mode with bcb_write/bcb_read; 1 writer and
+                 1 reader only; every slice is contiguous, also at the wrap.
+    - records:   Bcb_t with the record layer; one record per message, a
+                 batch of -b records is published at once and the reader
+                 gives records back a batch at a time.
+    - parked:    Bcb_t with bcb_write/bcb_read, where an idle reader parks in
+                 bcb_wait and the writer calls bcb_notify; the number of wake
+                 system calls is shown.
+    - mcb:       Mcb_t with mcb_write/mcb_read; one record per message.
+    - locked:    Bcb_t wrapped in a mutex; a message is only written when
+                 there is room for all of it, and only read when all of it
+                 is there, so messages of different writers don't mix.
+
+  Build and run e.g. as
+
+    gcc -O2 -march=native -Wall -I . -o bench bench.c circbuffer.c circbuffer-mirror.c circbuffer-wait.c -lpthread
+    ./bench -w 2 -r 3 -m 256
+    ./bench -z -f bcb             # Message sizes from 1 byte to 64 KiB.
+    ./bench -W 4 -R 4 -m 64       # 4 writers and 4 readers; mcb and locked only.
+
+*/
+
+typedef struct Flavour_t {
+  const char *      name;
+  uint32_t          multi;        // Non zero when more writers and readers can share it.
+  uint8_t           pad[4];
+  void            (*init)(uint32_t size);
+  uint32_t        (*write)(const uint8_t data[], uint32_t num);
+  uint32_t        (*read)(uint8_t data[], uint32_t num);
+  void            (*flush)(void);   // Called by the writer after its last message; can be NULL.
+} Flavour_t;
+
+typedef struct Side_t {           // Context of the writer or the reader thread.
+  pthread_t         thread;
+  const Flavour_t * flavour;
+  uint64_t          spins;        // Number of calls that moved no data.
+  int32_t           core;         // Core to pin to; -1 for not pinned.
+  uint32_t          errors;       // Number of bytes with a wrong value, when verifying.
+} Side_t;
+
+static bcb_t              bcb;
+static scb_t              scb;
+static mcb_t              mcb;
+static pthread_mutex_t    Lock = PTHREAD_MUTEX_INITIALIZER;
+static uint64_t           total = 1ull << 30;
+static uint64_t           msgsread;     // Messages read by all readers so far.
+static uint32_t           msgsize = 64;
+static uint32_t           verify;
+static uint32_t           numw = 1;     // Number of writers and ...
+static uint32_t           numr = 1;     // ... readers.
+
+#define NUM(A) (sizeof(A) / sizeof(A[0]))
+
+static void     bInit(uint32_t size) { bcb = malloc(sizeof(Bcb_t) + size); bcb_init(bcb, size); }
+static uint32_t bWrite(const uint8_t data[], uint32_t num) { return bcb_write(bcb, data, num); }
+static uint32_t bRead(uint8_t data[], uint32_t num) { return bcb_read(bcb, data, num); }
+
+static uint32_t cWrite(const uint8_t data[], uint32_t num) {
+
+  uint32_t done = 0u;
+  Slice_t  Slice;
+
+  while (num && ! bcb_isfull(bcb)) {
+    bcb_writeslice(bcb, & Slice);
+    Slice.num = (Slice.num > num) ? num : Slice.num;
+    (void) memcpy(Slice.data, data, Slice.num);
+    num  -= Slice.num;
+    data += Slice.num;
+    done += Slice.num;
+    bcb_produced(bcb, & Slice);
+  }
+
+  return done;
+
+}
+
+static uint32_t cRead(uint8_t data[], uint32_t num) {
+
+  uint32_t done = 0u;
+  Slice_t  Slice;
+
+  while (num && ! bcb_isempty(bcb)) {
+    bcb_readslice(bcb, & Slice);
+    Slice.num = (Slice.num > num) ? num : Slice.num;
+    (void) memcpy(data, Slice.data, Slice.num);
+    bcb_consumed(bcb, & Slice);
+    num  -= Slice.num;
+    data += Slice.num;
+    done += Slice.num;
+  }
+
+  return done;
+
+}
+
+static void     sInit(uint32_t size) { if (posix_memalign((void **) & scb, 64, scbsize(size))) { exit(1); } scb_init(scb, size); }
+static uint32_t sWrite(const uint8_t data[], uint32_t num) { return scb_write(scb, data, num); }
+static uint32_t sRead(uint8_t data[], uint32_t num) { return scb_read(scb, data, num); }
+
+static Batch_t    WBatch;
+static Batch_t    RBatch;
+static uint32_t   batching = 16;
+
+static void     rInit(uint32_t size) { bInit(size); bcb_recwrite(bcb, & WBatch); bcb_recread(bcb, & RBatch); }
+static void     rFlush(void) { bcb_recproduced(& WBatch); }
+
+static uint32_t rWrite(const uint8_t data[], uint32_t num) {
+
+  uint8_t * rec = bcb_recreserve(& WBatch, num);
+
+  if (BCBTOOBIG == rec) { fprintf(stderr, "records: a %u byte message does not fit the buffer.\n", num); exit(1); }
+
+  if (! rec) {                                              // Publish what we have and look for more room.
+    bcb_recproduced(& WBatch);
+    bcb_recwrite(bcb, & WBatch);
+    if (! (rec = bcb_recreserve(& WBatch, num))) { return 0; }
+  }
+
+  (void) memcpy(rec, data, num);
+
+  if (WBatch.num == batching) {
+    bcb_recproduced(& WBatch);
+    bcb_recwrite(bcb, & WBatch);
+  }
+
+  return num;
+
+}
+
+static uint32_t rRead(uint8_t data[], uint32_t num) {
+
+  uint32_t  len;
+  uint8_t * rec = bcb_recnext(& RBatch, & len);
+
+  if (! rec) {                                              // Give back the whole batch and start a new one.
+    bcb_recconsumed(& RBatch);
+    bcb_recread(bcb, & RBatch);
+    if (! (rec = bcb_recnext(& RBatch, & len))) { return 0; }
+  }
+
+  num = (len > num) ? num : len;
+  (void) memcpy(data, rec, num);
+
+  return num;
+
+}
+
+static BWait_t    Wait;
+
+static void     pInit(uint32_t size) { bInit(size); bcb_waitinit(& Wait, bcb, 1000); }
+static void     pFlush(void) { printf("%u wake system calls.\n", Wait.wakes); }
+
+static uint32_t pWrite(const uint8_t data[], uint32_t num) {
+
+  uint32_t done = bcb_write(bcb, data, num);
+
+  if (done) { bcb_notify(& Wait); }
+
+  return done;
+
+}
+
+static uint32_t pRead(uint8_t data[], uint32_t num) {
+
+  if (bcb_isempty(bcb)) { bcb_wait(& Wait, 0); }            // Only called when a message is still to come.
+
+  return bcb_read(bcb, data, num);
+
+}
+
+static void     vInit(uint32_t size) { if (! (bcb = bcb_mirror(size))) { printf("No mirror.\n"); exit(1); } }
+
+static void     yield(mcb_t cb) { (void) cb; sched_yield(); }
+
+static void     mInit(uint32_t size) { size = 1u << (32 - __builtin_clz(size - 1)); if (posix_memalign((void **) & mcb, 64, mcbsize(size))) { exit(1); } mcb_init(mcb, size); mcb->contcb = yield; }
+static uint32_t mWrite(const uint8_t data[], uint32_t num) {
+  uint32_t r = mcb_write(mcb, data, num);
+  if (MCBTOOBIG == r) { fprintf(stderr, "mcb: a %u byte message does not fit the ring.\n", num); exit(1); }
+  return r;
+}
+static uint32_t mRead(uint8_t data[], uint32_t num) { return mcb_read(mcb, data, num); }
+
+static uint32_t lWrite(const uint8_t data[], uint32_t num) {
+
+  uint32_t done = 0;
+
+  pthread_mutex_lock(& Lock);
+  if (bcb_canwrite(bcb) >= num) { done = bcb_write(bcb, data, num); }
+  pthread_mutex_unlock(& Lock);
+
+  return done;
+
+}
+
+static uint32_t lRead(uint8_t data[], uint32_t num) {
+
+  uint32_t done = 0;
+
+  pthread_mutex_lock(& Lock);
+  if (bcb_canread(bcb) >= num) { done = bcb_read(bcb, data, num); }
+  pthread_mutex_unlock(& Lock);
+
+  return done;
+
+}
+
+static const Flavour_t Flavours[] = {
+  { "bcb",      0, { 0 }, bInit,    bWrite,   bRead,    NULL    },
+  { "slices",   0, { 0 }, bInit,    cWrite,   cRead,    NULL    },
+  { "scb",      0, { 0 }, sInit,    sWrite,   sRead,    NULL    },
+  { "mirror",   0, { 0 }, vInit,    bWrite,   bRead,    NULL    },
+  { "records",  0, { 0 }, rInit,    rWrite,   rRead,    rFlush  },
+  { "parked",   0, { 0 }, pInit,    pWrite,   pRead,    pFlush  },
+  { "mcb",      1, { 0 }, mInit,    mWrite,   mRead,    NULL    },
+  { "locked",   1, { 0 }, bInit,    lWrite,   lRead,    NULL    },
+};
+
+static uint64_t now(void) {
+
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, & ts);
+
+  return (uint64_t) ts.tv_sec * 1000000000ull + (uint64_t) ts.tv_nsec;
+
+}
+
+static void pin(int32_t core) {
+
+  cpu_set_t set;
+
+  if (core >= 0) {
+    CPU_ZERO(& set);
+    CPU_SET((size_t) core, & set);
+    if (pthread_setaffinity_np(pthread_self(), sizeof(set), & set)) {
+      printf("Could not pin to core %d; running unpinned.\n", core);
+    }
+  }
+
+}
+
+static void * writer(void * arg) {
+
+  Side_t *  side = arg;
+  uint8_t * msg = malloc(msgsize);
+  uint64_t  offset = 0;
+  uint32_t  done;
+  uint32_t  i;
+
+  pin(side->core);
+
+  memset(msg, 0x5a, msgsize);
+
+  while (offset < total / numw) {
+    if (verify) {
+      for (i = 0; i < msgsize; i++) { msg[i] = (uint8_t) (offset + i); }
+    }
+    for (done = 0; done < msgsize; ) {                      // Write the whole message.
+      uint32_t w = side->flavour->write(msg + done, msgsize - done);
+      if (! w) { side->spins++; sched_yield(); }            // Full; let a reader run, e.g. on a single core.
+      done += w;
+    }
+    offset += msgsize;
+  }
+
+  if (side->flavour->flush) { side->flavour->flush(); }
+
+  free(msg);
+
+  return NULL;
+
+}
+
+static void * reader(void * arg) {
+
+  Side_t *  side = arg;
+  uint8_t * msg = malloc(msgsize);
+  uint64_t  msgs = total / msgsize;
+  uint64_t  offset = 0;
+  uint32_t  done;
+  uint32_t  i;
+
+  pin(side->core);
+
+  while (__atomic_load_n(& msgsread, __ATOMIC_RELAXED) < msgs) {
+    for (done = 0; done < msgsize; ) {                      // Read the whole message.
+      uint32_t r = side->flavour->read(msg + done, msgsize - done);
+      if (! r) {
+        if (! done && __atomic_load_n(& msgsread, __ATOMIC_RELAXED) >= msgs) { break; }
+        side->spins++;
+        sched_yield();                                      // Empty; let a writer run.
+      }
+      done += r;
+    }
+    if (done < msgsize) { break; }                          // Others have read the last messages.
+    if (verify) {
+      if (1 == numw && 1 == numr) {                         // The stream offset is known.
+        for (i = 0; i < msgsize; i++) {
+          if (msg[i] != (uint8_t) (offset + i)) { side->errors++; }
+        }
+      }
+      else {                                                // Only the offsets within the message are known.
+        for (i = 0; i < msgsize; i++) {
+          if (msg[i] != (uint8_t) (msg[0] + i)) { side->errors++; }
+        }
+      }
+    }
+    offset += msgsize;
+    __atomic_add_fetch(& msgsread, 1, __ATOMIC_RELAXED);
+  }
+
+  free(msg);
+
+  return NULL;
+
+}
+
+static void run(const Flavour_t * flavour, uint32_t size, int32_t wcore, int32_t rcore) {
+
+  Side_t   W[numw];
+  Side_t   R[numr];
+  uint64_t t0;
+  uint64_t ns;
+  uint64_t wspins = 0;
+  uint64_t rspins = 0;
+  uint32_t errors = 0;
+  uint32_t i;
+
+  if (! flavour->multi && (numw > 1 || numr > 1)) {
+    printf("%-8s only for 1 writer and 1 reader.\n", flavour->name);
+    return;
+  }
+
+  memset(W, 0x00, sizeof(W));
+  memset(R, 0x00, sizeof(R));
+  msgsread = 0;
+
+  flavour->init(size);
+
+  t0 = now();
+  for (i = 0; i < numr; i++) {
+    R[i].flavour = flavour;
+    R[i].core = (1 == numr) ? rcore : -1;
+    pthread_create(& R[i].thread, NULL, reader, & R[i]);
+  }
+  for (i = 0; i < numw; i++) {
+    W[i].flavour = flavour;
+    W[i].core = (1 == numw) ? wcore : -1;
+    pthread_create(& W[i].thread, NULL, writer, & W[i]);
+  }
+  for (i = 0; i < numw; i++) {
+    pthread_join(W[i].thread, NULL);
+    wspins += W[i].spins;
+  }
+  for (i = 0; i < numr; i++) {
+    pthread_join(R[i].thread, NULL);
+    rspins += R[i].spins;
+    errors += R[i].errors;
+  }
+  ns = now() - t0;
+
+  printf("%-8s %6u byte messages, %u/%u writers/readers: %8.1f MB/s, %6.2f Mmsg/s, %"PRIu64"/%"PRIu64" writer/reader spins%s\n",
+    flavour->name, msgsize, numw, numr,
+    (double) total * 1000.0 / (double) ns,
+    (double) (total / msgsize) * 1000.0 / (double) ns,
+    wspins, rspins,
+    verify ? (errors ? ", VERIFY FAILED" : ", verified") : "");
+
+}
+
+static struct option long_options[] = {
+  { "flavour",    1, NULL, 'f' },
+  { "message",    1, NULL, 'm' },
+  { "size",       1, NULL, 's' },
+  { "total",      1, NULL, 't' },
+  { "writer",     1, NULL, 'w' },
+  { "reader",     1, NULL, 'r' },
+  { "verify",     0, NULL, 'v' },
+  { "batch",      1, NULL, 'b' },
+  { "sweep",      0, NULL, 'z' },
+  { "writers",    1, NULL, 'W' },
+  { "readers",    1, NULL, 'R' },
+  { "help",       0, NULL, 'h' },
+  { NULL,         0, NULL,  0  }
+};
+
+int main(int argc, char * argv[]) {
+
+  const char * only = NULL;
+  uint32_t     size = 64 * 1024;
+  uint32_t     sweep = 0;
+  uint64_t     limit;
+  int32_t      wcore = -1;
+  int32_t      rcore = -1;
+  int          c;
+  uint32_t     i;
+
+  while ((c = getopt_long(argc, argv, "f:m:s:t:w:r:vb:zW:R:h", long_options, NULL)) != -1) {
+    switch (c) {
+      case 'f': only = optarg; break;
+      case 'm': msgsize = (uint32_t) atoi(optarg); break;
+      case 's': size = (uint32_t) atoi(optarg); break;
+      case 't': total = (uint64_t) atoll(optarg) << 20; break;
+      case 'w': wcore = atoi(optarg); break;
+      case 'r': rcore = atoi(optarg); break;
+      case 'v': verify = 1; break;
+      case 'z': sweep = 1; break;
+      case 'b': batching = (uint32_t) atoi(optarg); break;
+      case 'W': numw = (uint32_t) atoi(optarg); break;
+      case 'R': numr = (uint32_t) atoi(optarg); break;
+      case 'h':
+      default: {
+        printf("--flavour    -f : only run the given flavour.\n");
+        printf("--message    -m : message size in bytes; default %u.\n", msgsize);
+        printf("--size       -s : buffer size in bytes; default %u.\n", size);
+        printf("--total      -t : MBytes to stream; default %u.\n", (uint32_t) (total >> 20));
+        printf("--writer     -w : core to pin the writer to.\n");
+        printf("--reader     -r : core to pin the reader to.\n");
+        printf("--verify     -v : check every byte that is read.\n");
+        printf("--batch      -b : records per published batch; default %u.\n", batching);
+        printf("--sweep      -z : run message sizes from 1 byte to 64 KiB, at most 4M messages each.\n");
+        printf("--writers    -W : number of writer threads; default %u.\n", numw);
+        printf("--readers    -R : number of reader threads; default %u.\n", numr);
+        exit(0);
+      }
+    }
+  }
+
+  if (! msgsize || ! size || ! numw || ! numr) {
+    printf("Message size, buffer size and number of threads must not be 0.\n");
+    exit(1);
+  }
+
+  limit = total;
+
+  for (msgsize = sweep ? 1 : msgsize; msgsize <= (sweep ? 65536u : msgsize); msgsize *= 2) {
+    total = limit;
+    if (sweep && total > ((uint64_t) msgsize << 22)) {      // Limit the time spent on small messages.
+      total = (uint64_t) msgsize << 22;
+    }
+    total -= total % ((uint64_t) msgsize * numw);           // Whole messages only, the same number for each writer.
+    for (i = 0; i < NUM(Flavours); i++) {
+      if (! only || ! strcmp(only, Flavours[i].name)) {
+        run(& Flavours[i], size, wcore, rcore);
+      }
+    }
+    if (! sweep) { break; }
+  }
+
+  return 0;
+
+}
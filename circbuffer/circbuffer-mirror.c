@@ -0,0 +1,79 @@
+// Copyright (c) 2020,2021-2025 Steven Buytaert
+
+#define _GNU_SOURCE
+
+#include <stddef.h>
+#include <unistd.h>
+#include <circbuffer.h>
+
+#if defined(__linux__)
+
+#include <sys/mman.h>
+
+/*
+  The layout of the mappings is
+
+    | header page | buffer space | buffer space again |
+
+  where the Bcb_t structure is placed at the end of the header page, so that
+  its buff member starts exactly at the first mapping of the buffer space.
+  Both buffer mappings share the same memory file, so a write beyond the end
+  of the first, lands at the start of it.
+*/
+
+static size_t pagesize(void) {
+  return (size_t) sysconf(_SC_PAGESIZE);
+}
+
+bcb_t bcb_mirror(uint32_t size) {
+
+  size_t    page = pagesize();
+  size_t    len = ((size_t) size + 1 + page - 1) & ~(page - 1);  // Buffer space, including the empty slot.
+  uint8_t * base = MAP_FAILED;
+  bcb_t     cb = NULL;
+  int       fd;
+
+  if (offsetof(Bcb_t, buff) > page || len - 1 > UINT32_MAX) { return NULL; }
+
+  fd = memfd_create("bcb", MFD_CLOEXEC);
+  if (fd < 0) { return NULL; }
+
+  if (0 == ftruncate(fd, (off_t) len)) {                    // Reserve the whole range first; the header page stays anonymous.
+    base = mmap(NULL, page + 2 * len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  }
+
+  if (MAP_FAILED != base) {
+    if (MAP_FAILED == mmap(base + page, len, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) ||
+        MAP_FAILED == mmap(base + page + len, len, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0)) {
+      munmap(base, page + 2 * len);
+    }
+    else {
+      cb = (bcb_t) (base + page - offsetof(Bcb_t, buff));
+      bcb_init(cb, (uint32_t) (len - 1));                   // Then end is exactly the start of the mirror.
+      cb->mirror = 1;
+    }
+  }
+
+  close(fd);                                                // The mappings keep the memory file alive.
+
+  return cb;
+
+}
+
+void bcb_unmirror(bcb_t cb) {
+
+  size_t page = pagesize();
+
+  if (cb) {
+    munmap(cb->buff - page, page + 2 * ((size_t) cb->size + 1));
+  }
+
+}
+
+#else
+
+bcb_t bcb_mirror(uint32_t size) { (void) size; return NULL; }
+
+void bcb_unmirror(bcb_t cb) { (void) cb; }
+
+#endif // __linux__
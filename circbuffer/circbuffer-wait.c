@@ -0,0 +1,99 @@
+// Copyright (c) 2020,2021-2025 Steven Buytaert
+
+#define _GNU_SOURCE
+
+#include <time.h>
+#include <sched.h>
+#include <circbuffer.h>
+
+#if defined(__linux__)
+
+#include <unistd.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+
+static void park(bwait_t wait, uint32_t seq, const struct timespec * ts) {
+  (void) syscall(SYS_futex, & wait->seq, FUTEX_WAIT_PRIVATE, seq, ts, NULL, 0);  // Returns at once when seq changed.
+}
+
+static void unpark(bwait_t wait) {
+  (void) syscall(SYS_futex, & wait->seq, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+}
+
+#else
+
+static void park(bwait_t wait, uint32_t seq, const struct timespec * ts) {
+  (void) wait; (void) seq; (void) ts;
+  (void) sched_yield();                                     // No futex; just let others run.
+}
+
+static void unpark(bwait_t wait) { (void) wait; }
+
+#endif // __linux__
+
+static uint64_t now(void) {                                 // In milliseconds.
+
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, & ts);
+
+  return (uint64_t) ts.tv_sec * 1000u + (uint64_t) ts.tv_nsec / 1000000u;
+
+}
+
+void bcb_waitinit(bwait_t wait, bcb_t cb, uint32_t spins) {
+
+  wait->cb     = cb;
+  wait->seq    = 0;
+  wait->parked = 0;
+  wait->spins  = spins;
+  wait->wakes  = 0;
+
+}
+
+uint32_t bcb_wait(bwait_t wait, uint32_t ms) {
+
+  uint64_t        deadline = ms ? now() + ms : 0;
+  uint64_t        left;
+  uint32_t        seq;
+  uint32_t        i;
+  struct timespec Ts;
+
+  for (i = 0; i < wait->spins; i++) {                       // Spin briefly first.
+    if (! bcb_isempty(wait->cb)) { return bcb_canread(wait->cb); }
+  }
+
+  while (bcb_isempty(wait->cb)) {
+    seq = __atomic_load_n(& wait->seq, __ATOMIC_ACQUIRE);
+    __atomic_store_n(& wait->parked, 1, __ATOMIC_SEQ_CST);  // Announce before the last check ...
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);                 // ... and order it before the load of put.
+    if (bcb_isempty(wait->cb)) {
+      if (deadline) {
+        left = now();
+        if (left >= deadline) { break; }                    // Timed out.
+        left = deadline - left;
+        Ts.tv_sec  = (time_t) (left / 1000u);
+        Ts.tv_nsec = (long) (left % 1000u) * 1000000;
+      }
+      park(wait, seq, deadline ? & Ts : NULL);
+    }
+  }
+
+  __atomic_store_n(& wait->parked, 0, __ATOMIC_RELAXED);
+
+  return bcb_canread(wait->cb);
+
+}
+
+void bcb_notify(bwait_t wait) {
+
+  __atomic_thread_fence(__ATOMIC_SEQ_CST);                   // Order the put store before the load of parked.
+
+  if (__atomic_load_n(& wait->parked, __ATOMIC_RELAXED)) {
+    __atomic_store_n(& wait->parked, 0, __ATOMIC_RELAXED);  // One wake is enough; the reader sets it again.
+    __atomic_add_fetch(& wait->seq, 1, __ATOMIC_RELEASE);
+    wait->wakes++;
+    unpark(wait);
+  }
+
+}
@@ -4,6 +4,99 @@
 #include <string.h>
 #include <circbuffer.h>
 
+#if defined(BCBSIMD) && defined(__AVX2__)
+
+#include <immintrin.h>
+
+static void copy(uint8_t * dst, const uint8_t * src, uint32_t num) {
+
+  uint32_t nt = BCBNTCOPY && num >= BCBNTCOPY;
+  uint32_t head;
+
+  if (num < 128) {                                          // Small; memcpy does best.
+    (void) memcpy(dst, src, num);
+    return;
+  }
+
+  if (nt) {                                                 // Streaming stores need an aligned destination.
+    head = (uint32_t) (-(uintptr_t) dst & 31u);
+    (void) memcpy(dst, src, head);
+    dst += head; src += head; num -= head;
+  }
+
+  for (; num >= 128; dst += 128, src += 128, num -= 128) {
+    __m256i a = _mm256_loadu_si256((const __m256i *) (src +  0));
+    __m256i b = _mm256_loadu_si256((const __m256i *) (src + 32));
+    __m256i c = _mm256_loadu_si256((const __m256i *) (src + 64));
+    __m256i d = _mm256_loadu_si256((const __m256i *) (src + 96));
+    if (nt) {
+      _mm256_stream_si256((__m256i *) (dst +  0), a);
+      _mm256_stream_si256((__m256i *) (dst + 32), b);
+      _mm256_stream_si256((__m256i *) (dst + 64), c);
+      _mm256_stream_si256((__m256i *) (dst + 96), d);
+    }
+    else {
+      _mm256_storeu_si256((__m256i *) (dst +  0), a);
+      _mm256_storeu_si256((__m256i *) (dst + 32), b);
+      _mm256_storeu_si256((__m256i *) (dst + 64), c);
+      _mm256_storeu_si256((__m256i *) (dst + 96), d);
+    }
+  }
+
+  (void) memcpy(dst, src, num);
+
+  if (nt) {
+    _mm_sfence();                                           // Streaming stores must be visible before the index is.
+  }
+
+}
+
+#elif defined(BCBSIMD) && defined(__ARM_NEON)
+
+#include <arm_neon.h>
+
+static void copy(uint8_t * dst, const uint8_t * src, uint32_t num) {
+
+  if (num < 128) {                                          // Small; memcpy does best.
+    (void) memcpy(dst, src, num);
+    return;
+  }
+
+  for (; num >= 64; dst += 64, src += 64, num -= 64) {      // No non temporal stores here.
+    uint8x16_t a = vld1q_u8(src +  0);
+    uint8x16_t b = vld1q_u8(src + 16);
+    uint8x16_t c = vld1q_u8(src + 32);
+    uint8x16_t d = vld1q_u8(src + 48);
+    vst1q_u8(dst +  0, a);
+    vst1q_u8(dst + 16, b);
+    vst1q_u8(dst + 32, c);
+    vst1q_u8(dst + 48, d);
+  }
+
+  (void) memcpy(dst, src, num);
+
+}
+
+#else
+
+static void copy(uint8_t * dst, const uint8_t * src, uint32_t num) {
+  (void) memcpy(dst, src, num);
+}
+
+#endif // BCBSIMD
+
+static uint8_t * advance(const Bcb_t * cb, uint8_t * at, uint32_t num) { // Advance and wrap; beyond end only in the mirror.
+
+  at += num;
+
+  if (at >= cb->end) {
+    at -= cb->end - cb->buff;
+  }
+
+  return at;
+
+}
+
 uint8_t bcb_get(bcb_t cb) {
 
   uint8_t * get = cb->get;
@@ -71,7 +164,7 @@ uint32_t bcb_canread(const Bcb_t * cb) {
     num = (uint32_t) (put - get);
   }
   else {
-    num = cb->size - (uint32_t) (get - put);
+    num = cb->size + 1 - (uint32_t) (get - put);            // Slots from get to end, plus from start to put
   }
    
   return num;
@@ -88,7 +181,7 @@ uint32_t bcb_canwrite(const Bcb_t * cb) {
     num = cb->size;
   }
   else if (get < put) {
-    num = (cb->size - (uint32_t) (put - get)) - 1;
+    num = cb->size - (uint32_t) (put - get);                // There are size + 1 slots; 1 stays empty
   }
   else {
     assert(get > put);
@@ -109,6 +202,9 @@ void bcb_readslice(const Bcb_t * cb, slice_t slice) {
   if (get <= put) {                                         // Also handles the case where get == put == empty buffer
     slice->num = (uint32_t) (put - get);
   }
+  else if (cb->mirror) {                                    // Continue in the mirror, up to put
+    slice->num = (uint32_t) (cb->end - get) + (uint32_t) (put - cb->buff);
+  }
   else {
     slice->num = (uint32_t) (cb->end - get);                // Take what remains between current get and end of the buffer
   }
@@ -126,17 +222,16 @@ void bcb_consumed(bcb_t cb, const Slice_t * slice) {
   uint8_t * get = cb->get;
 
   assert(slice->max >= slice->num);                         // (X) Check that we've never commit more then what was available in bcb_readslice
-  assert(get + slice->num <= cb->end);                      // Should never go beyond end
+  assert(cb->mirror || get + slice->num <= cb->end);        // Should never go beyond end, except in the mirror
 
   if (get < slice->snap.put) {                              // (Y) If get is less then the saved put pointer (note this 'if' is optimized away) ...
     assert(get + slice->num <= slice->snap.put);            // ... it should never go beyond the saved put; when they become equal, the buffer is empty
   }
    
-  if ((get + slice->num) == cb->end) {                      // Note that num is guaranteed smaller or equal to num set in readslice
-    get = cb->buff;                                         // Never wrap beyond put !!
-  }
-  else {
-    get += slice->num;                                      // Note that num is guaranteed smaller or equal to num set in readslice
+  get += slice->num;                                        // Note that num is guaranteed smaller or equal to num set in readslice
+
+  if (get >= cb->end) {                                     // Never wrap beyond put !!
+    get -= cb->end - cb->buff;                              // Only beyond end in the mirror
   }
    
   cb->get = get;                                            // Assign atomically
@@ -148,7 +243,10 @@ void bcb_writeslice(const Bcb_t * cb, slice_t slice) {
   uint8_t * get = cb->get;                                  // Snapshot of get pointer first, it can be manipulated under our feet by another thread
   uint8_t * put = cb->put;
 
-  if (put >= get) {
+  if (put >= get && cb->mirror) {                           // Continue in the mirror, up to get
+    slice->num = (uint32_t) (cb->end - put) + (uint32_t) (get - cb->buff) - 1;
+  }
+  else if (put >= get) {
     slice->num = (uint32_t) (cb->end - put);
     if (get == cb->buff) {
       slice->num -= 1u;                                     // Adjust available space, put must not run into get
@@ -171,17 +269,16 @@ void bcb_produced(bcb_t cb, const Slice_t * slice) {
   uint8_t * put = cb->put;
 
   assert(slice->max >= slice->num);                         // Check that we've never commit more then what was available in bcb_writeslice
-  assert(put + slice->num <= cb->end);                      // Should never go beyond end
+  assert(cb->mirror || put + slice->num <= cb->end);        // Should never go beyond end, except in the mirror
 
   if (put < slice->snap.get) {                              // If put less then saved get pointer ...
     assert(put + slice->num < slice->snap.get);             // ... put should not overtake get
   }
    
-  if ((put + slice->num) == cb->end) {
-    put = cb->buff;                                         // Wrap around to start
-  }
-  else {
-    put += slice->num;                                      // Just advance next put position
+  put += slice->num;                                        // Just advance next put position
+
+  if (put >= cb->end) {
+    put -= cb->end - cb->buff;                              // Wrap around to start; only beyond end in the mirror
   }
    
   assert(0 == slice->num || put != slice->snap.get);        // When we produced data, put should never become get because it would mean we're empty
@@ -192,48 +289,502 @@ void bcb_produced(bcb_t cb, const Slice_t * slice) {
 
 uint32_t bcb_write(bcb_t cb, const uint8_t data[], uint32_t num) {
 
+  uint8_t * get = cb->get;                                  // Snapshot of get first, as for bcb_writeslice
+  uint8_t * put = cb->put;
+  uint32_t  room = (put >= get) ? (uint32_t) (cb->end - cb->buff) - 1 - (uint32_t) (put - get) : (uint32_t) (get - put) - 1;
+  uint32_t  first;
+
+  num   = (num > room) ? room : num;                        // Truncate to the space available
+  first = (uint32_t) (cb->end - put);                       // Contiguous part up to the end ...
+  first = (cb->mirror || first > num) ? num : first;        // ... or all of it
+
+  copy(put, data, first);
+  copy(cb->buff, data + first, num - first);                // Wrapped part, if any
+
+  if (num) {
+    cb->put = advance(cb, put, num);                        // Assign new put atomically, once
+  }
+
+  return num;                                               // Return bytes actually written
+
+}
+
+uint32_t bcb_read(bcb_t cb, uint8_t data[], uint32_t num) {
+
+  uint8_t * put = cb->put;                                  // Snapshot of put first, as for bcb_readslice
+  uint8_t * get = cb->get;
+  uint32_t  avail = (get <= put) ? (uint32_t) (put - get) : (uint32_t) (cb->end - get) + (uint32_t) (put - cb->buff);
+  uint32_t  first;
+
+  num   = (num > avail) ? avail : num;                      // Only what is there
+  first = (uint32_t) (cb->end - get);
+  first = (cb->mirror || first > num) ? num : first;
+
+  copy(data, get, first);
+  copy(data + first, cb->buff, num - first);
+
+  if (num) {
+    cb->get = advance(cb, get, num);                        // Assign atomically, once
+  }
+
+  return num;                                               // Return bytes actually read
+
+}
+
+#define RECSKIP 0xffffffffu         // Length that marks a skipped tail.
+
+static uint32_t load32(const uint8_t * at) {                // Record lengths can be unaligned.
+
+  uint32_t value;
+
+  (void) memcpy(& value, at, sizeof(value));
+
+  return value;
+
+}
+
+static void store32(uint8_t * at, uint32_t value) {
+  (void) memcpy(at, & value, sizeof(value));
+}
+
+void bcb_recwrite(bcb_t cb, batch_t batch) {
+
+  uint8_t * get = cb->get;                                  // Snapshot of get first, as for bcb_writeslice
+  uint8_t * put = cb->put;
+
+  batch->cb    = cb;
+  batch->at    = put;
+  batch->avail = (put >= get) ? (uint32_t) (cb->end - cb->buff) - 1 - (uint32_t) (put - get) : (uint32_t) (get - put) - 1;
+  batch->num   = 0;
+
+}
+
+uint8_t * bcb_recreserve(batch_t batch, uint32_t num) {
+
+  bcb_t     cb = batch->cb;
+  uint8_t * rec = NULL;
+  uint32_t  need = (uint32_t) sizeof(uint32_t) + num;
+  uint32_t  ring = (uint32_t) (cb->end - cb->buff);
+  uint32_t  tail = cb->mirror ? need : (uint32_t) (cb->end - batch->at);
+
+  if (need < num || need > (cb->mirror ? ring - 1 : ring / 2)) {
+    return BCBTOOBIG;                                       // Else a skipped tail may leave too little room, forever.
+  }
+
+  if (tail < need) {                                        // Does not fit before the end; skip the tail.
+    if (batch->avail < tail || batch->avail - tail < need) { return NULL; }
+    if (tail >= sizeof(uint32_t)) {                         // Else the reader skips it without a marker.
+      store32(batch->at, RECSKIP);
+    }
+    batch->avail -= tail;
+    batch->at     = cb->buff;
+  }
+
+  if (batch->avail >= need) {
+    store32(batch->at, num);
+    rec = batch->at + sizeof(uint32_t);
+    batch->at     = advance(cb, batch->at, need);
+    batch->avail -= need;
+    batch->num   += 1;
+  }
+
+  return rec;
+
+}
+
+void bcb_recproduced(const Batch_t * batch) {
+
+  assert(batch->at != batch->cb->get || ! batch->num);     // Put should never run into get.
+
+  batch->cb->put = batch->at;                               // Publish all records at once; assign atomically
+
+}
+
+void bcb_recread(bcb_t cb, batch_t batch) {
+
+  uint8_t * put = cb->put;                                  // Snapshot of put first, as for bcb_readslice
+  uint8_t * get = cb->get;
+
+  batch->cb    = cb;
+  batch->at    = get;
+  batch->avail = (get <= put) ? (uint32_t) (put - get) : (uint32_t) (cb->end - get) + (uint32_t) (put - cb->buff);
+  batch->num   = 0;
+
+}
+
+uint8_t * bcb_recnext(batch_t batch, uint32_t * num) {
+
+  bcb_t     cb = batch->cb;
+  uint8_t * rec = NULL;
+  uint32_t  tail = (uint32_t) (cb->end - batch->at);
+
+  if (batch->avail && ! cb->mirror) {                       // Skip a tail that the writer skipped.
+    if (tail < sizeof(uint32_t) || RECSKIP == load32(batch->at)) {
+      assert(batch->avail > tail);                          // A record always follows a skipped tail.
+      batch->avail -= tail;
+      batch->at     = cb->buff;
+    }
+  }
+
+  if (batch->avail) {
+    *num = load32(batch->at);
+    assert(batch->avail >= sizeof(uint32_t) + *num);
+    rec = batch->at + sizeof(uint32_t);
+    batch->at     = advance(cb, batch->at, (uint32_t) sizeof(uint32_t) + *num);
+    batch->avail -= (uint32_t) sizeof(uint32_t) + *num;
+    batch->num   += 1;
+  }
+
+  return rec;
+
+}
+
+void bcb_recconsumed(const Batch_t * batch) {
+
+  batch->cb->get = batch->at;                               // Give back all records at once; assign atomically
+
+}
+
+void bcb_init(bcb_t cb, uint32_t size) {
+
+  cb->put  = cb->buff;
+  cb->get  = cb->buff;
+  cb->size = size;
+  cb->mirror = 0;
+  cb->wrap = cb->buff + cb->size;                           // Note that we have 4 extra cells in the header
+  cb->end  = cb->wrap + 1;                                  // We precalculate end so that we don't have to do additions to get for overflow
+
+}
+
+static uint8_t * acquire(uint8_t * const * index) {         // Load an index of the other side.
+  return __atomic_load_n(index, __ATOMIC_ACQUIRE);
+}
+
+static void release(uint8_t ** index, uint8_t * value) {    // Publish an own index to the other side.
+  __atomic_store_n(index, value, __ATOMIC_RELEASE);
+}
+
+static uint32_t readable(const Scb_t * cb, const uint8_t * get, const uint8_t * put) {
+
+  return (uint32_t) ((get <= put) ? put - get : cb->end - get);  // Contiguous part only; see bcb_readslice.
+
+}
+
+static uint32_t writable(const Scb_t * cb, const uint8_t * get, const uint8_t * put) {
+
+  uint32_t num;
+
+  if (put >= get) {
+    num = (uint32_t) (cb->end - put);
+    if (get == cb->buff) {
+      num -= 1u;                                            // Put must not run into get.
+    }
+  }
+  else {
+    num = (uint32_t) (get - put) - 1;
+  }
+
+  return num;                                               // Contiguous part only; see bcb_writeslice.
+
+}
+
+uint32_t scb_canread(const Scb_t * cb) {
+
+  uint8_t * put = acquire(& cb->W.put);                     // Read, so snapshot of put first ...
+  uint8_t * get = acquire(& cb->R.get);                     // ... then get
+
+  return (get <= put) ? (uint32_t) (put - get) : cb->size + 1 - (uint32_t) (get - put);
+
+}
+
+uint32_t scb_canwrite(const Scb_t * cb) {
+
+  uint8_t * get = acquire(& cb->R.get);                     // Write, take snapshot of get first ...
+  uint8_t * put = acquire(& cb->W.put);                     // ... then put
+
+  if (get == put) {
+    return cb->size;
+  }
+
+  return (get < put) ? cb->size - (uint32_t) (put - get) : (uint32_t) (get - put - 1);
+
+}
+
+void scb_readslice(scb_t cb, slice_t slice) {
+
+  uint8_t * get = cb->R.get;                                // Only we change get.
+  uint8_t * put = cb->R.put;                                // Shadow; never ahead of the real put.
+
+  if (get == put) {                                         // Looks empty; refresh the shadow.
+    put = cb->R.put = acquire(& cb->W.put);
+  }
+
+  slice->num  = readable(cb, get, put);
+  slice->data = get;
+
+  assert((slice->snap.put = put, 1));                       // Same checks as for bcb_readslice.
+  assert((slice->max = slice->num, 1));
+  assert(slice->num <= cb->size);
+
+}
+
+void scb_consumed(scb_t cb, const Slice_t * slice) {
+
+  uint8_t * get = cb->R.get;
+
+  assert(slice->max >= slice->num);
+  assert(get + slice->num <= cb->end);
+  assert(get >= slice->snap.put || get + slice->num <= slice->snap.put);
+
+  get += slice->num;
+  if (get == cb->end) {
+    get = cb->buff;
+  }
+
+  release(& cb->R.get, get);                                // Our reads are done before the writer sees the room.
+
+}
+
+void scb_writeslice(scb_t cb, slice_t slice) {
+
+  uint8_t * put = cb->W.put;                                // Only we change put.
+  uint8_t * get = cb->W.get;                                // Shadow; never ahead of the real get.
+
+  slice->num = writable(cb, get, put);
+
+  if (0 == slice->num) {                                    // Looks full; refresh the shadow.
+    get = cb->W.get = acquire(& cb->R.get);
+    slice->num = writable(cb, get, put);
+  }
+
+  slice->data = put;
+
+  assert((slice->snap.get = get, 1));                       // Same checks as for bcb_writeslice.
+  assert((slice->max = slice->num, 1));
+  assert(slice->num <= cb->size);
+
+}
+
+void scb_produced(scb_t cb, const Slice_t * slice) {
+
+  uint8_t * put = cb->W.put;
+
+  assert(slice->max >= slice->num);
+  assert(put + slice->num <= cb->end);
+  assert(put >= slice->snap.get || put + slice->num < slice->snap.get);
+
+  put += slice->num;
+  if (put == cb->end) {
+    put = cb->buff;
+  }
+
+  assert(0 == slice->num || put != slice->snap.get);        // Put should never become get; we would be empty.
+
+  release(& cb->W.put, put);                                // Our writes are done before the reader sees the data.
+
+}
+
+uint32_t scb_write(scb_t cb, const uint8_t data[], uint32_t num) {
+
   uint32_t done = 0u;
   Slice_t  Slice;
 
-  while (num && ! bcb_isfull(cb)) {
-    bcb_writeslice(cb, & Slice);
-    Slice.num = (Slice.num > num) ? num : Slice.num;        // Truncate if what remains to be written is less then space available
-    (void) memcpy(Slice.data, data, Slice.num);             // Do the copy
+  while (num) {
+    scb_writeslice(cb, & Slice);
+    if (0 == Slice.num) { break; }                          // Still full after a refresh.
+    Slice.num = (Slice.num > num) ? num : Slice.num;
+    copy(Slice.data, data, Slice.num);
     num  -= Slice.num;
     data += Slice.num;
     done += Slice.num;
-    bcb_produced(cb, & Slice);
+    scb_produced(cb, & Slice);
   }
 
-  return done;                                              // Return bytes actually written
+  return done;
 
 }
 
-uint32_t bcb_read(bcb_t cb, uint8_t data[], uint32_t num) {
+uint32_t scb_read(scb_t cb, uint8_t data[], uint32_t num) {
 
   uint8_t * d = data;
-  uint32_t  r = num;                                        // Remaining to be read
+  uint32_t  r = num;
   Slice_t   Slice;
 
-  while (r && ! bcb_isempty(cb)) {
-    bcb_readslice(cb, & Slice);
-    Slice.num = (Slice.num > r) ? r : Slice.num;            // Only advance number of bytes still available in user buffer
-    (void) memcpy(d, Slice.data, Slice.num);                // Copy to user buffer
-    bcb_consumed(cb, & Slice);                              // Tell actual number of bytes consumed from this slice
+  while (r) {
+    scb_readslice(cb, & Slice);
+    if (0 == Slice.num) { break; }                          // Still empty after a refresh.
+    Slice.num = (Slice.num > r) ? r : Slice.num;
+    copy(d, Slice.data, Slice.num);
+    scb_consumed(cb, & Slice);
     r -= Slice.num;
     d += Slice.num;
   }
 
-  return (uint32_t) (d - data);                             // Return bytes actually read
+  return (uint32_t) (d - data);
 
 }
 
-void bcb_init(bcb_t cb, uint32_t size) {
+void scb_init(scb_t cb, uint32_t size) {
 
-  cb->put  = cb->buff;
-  cb->get  = cb->buff;
-  cb->size = size;
-  cb->wrap = cb->buff + cb->size;                           // Note that we have 4 extra cells in the header
-  cb->end  = cb->wrap + 1;                                  // We precalculate end so that we don't have to do additions to get for overflow
+  assert(0 == ((uintptr_t) cb->buff & 63));                 // Buffer space starts on a cache line.
+
+  cb->size  = size;
+  cb->wrap  = cb->buff + size;
+  cb->end   = cb->wrap + 1;
+  cb->W.put = cb->W.get = cb->buff;
+  cb->R.get = cb->R.put = cb->buff;
+
+}
+
+typedef struct MHdr_t {           // Header of a record in a Mcb_t.
+  uint32_t num;                   // Number of content bytes; MCBSKIP for a skipped tail.
+  uint32_t span;                  // Number of bytes taken, including this header.
+} MHdr_t;
+
+#define MCBSKIP 0xffffffffu
+
+static void nothing(mcb_t cb) { (void) cb; }                // Default contention callback.
+
+static MHdr_t * pos2hdr(const Mcb_t * cb, uint64_t pos) {
+  return (MHdr_t *) (cb->buff + (pos & cb->mask));
+}
+
+static uint32_t hdrload(const uint32_t * word) {            // Relaxed; a stale header is only used for a failing claim.
+  return __atomic_load_n(word, __ATOMIC_RELAXED);
+}
+
+static void hdrstore(MHdr_t * hdr, uint32_t num, uint32_t span) {
+  __atomic_store_n(& hdr->num,  num,  __ATOMIC_RELAXED);    // Published by the release of the commit counter.
+  __atomic_store_n(& hdr->span, span, __ATOMIC_RELAXED);
+}
+
+static void await(mcb_t cb, const MCount_t * count, uint64_t at) { // Wait until it is our turn.
+  while (__atomic_load_n(& count->value, __ATOMIC_ACQUIRE) != at) {
+    cb->contcb(cb);
+  }
+}
+
+uint32_t mcb_writeslice(mcb_t cb, mslice_t slice, uint32_t num) {
+
+  uint32_t span = (num + (uint32_t) sizeof(MHdr_t) + 7u) & ~7u;
+  uint32_t tail;
+  uint32_t need;
+  uint64_t at = __atomic_load_n(& cb->reserve.value, __ATOMIC_RELAXED);
+
+  if (! num || num > cb->size / 2 - sizeof(MHdr_t)) {        // Else a wrapped record may not even fit in an empty ring.
+    return MCBTOOBIG;
+  }
+
+  do {
+    tail = cb->size - (uint32_t) (at & cb->mask);
+    need = (span <= tail) ? span : tail + span;             // Skip the tail when the record does not fit before the end.
+    if (at + need - __atomic_load_n(& cb->release.value, __ATOMIC_ACQUIRE) > cb->size) {
+      return 0;                                             // Not enough room now.
+    }
+  } while (! __atomic_compare_exchange_n(& cb->reserve.value, & at, at + need, 0, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+
+  if (need != span) {                                       // Mark the tail as skipped; the record starts at the buffer.
+    hdrstore(pos2hdr(cb, at), MCBSKIP, tail);
+    hdrstore(pos2hdr(cb, 0), num, span);
+    slice->data = cb->buff + sizeof(MHdr_t);
+  }
+  else {
+    hdrstore(pos2hdr(cb, at), num, span);
+    slice->data = (uint8_t *) (pos2hdr(cb, at) + 1);
+  }
+
+  slice->num  = num;
+  slice->span = need;
+  slice->at   = at;
+
+  return num;
+
+}
+
+void mcb_produced(mcb_t cb, const MSlice_t * slice) {
+
+  await(cb, & cb->commit, slice->at);                       // Writers before us must have published first.
+
+  __atomic_store_n(& cb->commit.value, slice->at + slice->span, __ATOMIC_RELEASE);
+
+}
+
+uint32_t mcb_readslice(mcb_t cb, mslice_t slice) {
+
+  MHdr_t * hdr;
+  uint32_t num;
+  uint32_t span;
+  uint64_t at = __atomic_load_n(& cb->claim.value, __ATOMIC_RELAXED);
+
+  do {
+    if (at == __atomic_load_n(& cb->commit.value, __ATOMIC_ACQUIRE)) {
+      return 0;                                             // Nothing published to claim.
+    }
+    hdr  = pos2hdr(cb, at);
+    num  = hdrload(& hdr->num);
+    span = hdrload(& hdr->span);
+    if (MCBSKIP == num) {                                   // Skipped tail; record follows at the buffer start.
+      hdr   = pos2hdr(cb, 0);
+      num   = hdrload(& hdr->num);
+      span += hdrload(& hdr->span);
+    }
+  } while (! __atomic_compare_exchange_n(& cb->claim.value, & at, at + span, 0, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+
+  slice->data = (uint8_t *) (hdr + 1);
+  slice->num  = num;
+  slice->span = span;
+  slice->at   = at;
+
+  return 1;
+
+}
+
+void mcb_consumed(mcb_t cb, const MSlice_t * slice) {
+
+  await(cb, & cb->release, slice->at);                      // Readers before us must have given back first.
+
+  __atomic_store_n(& cb->release.value, slice->at + slice->span, __ATOMIC_RELEASE);
+
+}
+
+uint32_t mcb_write(mcb_t cb, const uint8_t data[], uint32_t num) {
+
+  MSlice_t Slice;
+  uint32_t r = mcb_writeslice(cb, & Slice, num);
+
+  if (num == r) {
+    (void) memcpy(Slice.data, data, num);
+    mcb_produced(cb, & Slice);
+  }
+
+  return r;
+
+}
+
+uint32_t mcb_read(mcb_t cb, uint8_t data[], uint32_t num) {
+
+  MSlice_t Slice;
+
+  if (mcb_readslice(cb, & Slice)) {
+    num = (Slice.num > num) ? num : Slice.num;
+    (void) memcpy(data, Slice.data, num);
+    mcb_consumed(cb, & Slice);
+    return num;
+  }
+
+  return 0;
+
+}
+
+void mcb_init(mcb_t cb, uint32_t size) {
+
+  assert(size >= 64 && 0 == (size & (size - 1)));           // A power of 2.
+  assert(0 == ((uintptr_t) cb->buff & 63));                 // Buffer space starts on a cache line.
+
+  memset(cb, 0x00, sizeof(Mcb_t));
+
+  cb->size   = size;
+  cb->mask   = size - 1;
+  cb->contcb = nothing;
 
 }
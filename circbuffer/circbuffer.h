@@ -10,7 +10,8 @@ typedef struct Slice_t * slice_t;
 
 typedef struct Bcb_t {            // Circular byte buffer, lock free for 1 reader and 1 writer.
   uint32_t             size;      // Usable size of the buffer at the tail.
-  uint8_t              pad[4];    // For alignment on 64 bit systems.
+  uint8_t              mirror;    // Non zero when the buffer is mapped twice, back to back; see bcb_mirror.
+  uint8_t              pad[3];    // For alignment on 64 bit systems.
   uint8_t *            wrap;      // Used in bcb_put and bcb_get to check if pointer should wrap around; points to a usable slot
   uint8_t *            end;       // Used for read and write remaining space calculation; points beyond the last usable slot, in other words == wrap + 1
   uint8_t * volatile   get;       // A volatile pointer *NOT* a pointer to a volatile
@@ -40,10 +41,252 @@ void     bcb_consumed(bcb_t cb, const Slice_t * slice);
 void     bcb_writeslice(const Bcb_t * cb, slice_t slice);
 void     bcb_produced(bcb_t cb, const Slice_t * slice);  
 
-// Most basic API, sometimes all you need.
+// Most basic API, sometimes all you need. bcb_write and bcb_read take a
+// single snapshot of the indices, do at most 2 copies, one up to the end and
+// one from the start of the buffer, and publish the index only once.
 
 void     bcb_init(bcb_t cb, uint32_t size);
 uint32_t bcb_write(bcb_t cb, const uint8_t data[], uint32_t num);
 uint32_t bcb_read(bcb_t cb, uint8_t data[], uint32_t num);
 
+// When BCBSIMD is defined and the compiler targets AVX2 (e.g. -mavx2 or
+// -march=native) or NEON, the copies of bcb_write, bcb_read, scb_write and
+// scb_read use vector loads and stores; small copies still go to memcpy.
+// With AVX2, copies of at least BCBNTCOPY bytes use non temporal stores, that
+// bypass the cache; use this when the data is not read again soon, e.g. a
+// large stream that is consumed much later. Set BCBNTCOPY to 0 to never use
+// them. Comment out BCBSIMD to always use memcpy.
+
+#define BCBSIMD   1
+#define BCBNTCOPY (1024 * 1024)
+
+/*
+  Record layer on top of a Bcb_t, for 1 reader and 1 writer that exchange
+  messages instead of bytes. Each record is a 4 byte length, in native byte
+  order, followed by the contents, and is always contiguous in the buffer;
+  when a record does not fit before the end, the tail is skipped, with a
+  marker when there is room for one. In mirrored mode, nothing is skipped
+  and a record, length included, can take the whole buffer size. Otherwise,
+  a record, length included, can be at most half of the buffer size plus 1,
+  else a record that does not fit before the end could wait for room
+  forever; bcb_recreserve returns BCBTOOBIG for such a record.
+
+  Records are written and read in batches, so that the put or get index is
+  published only once for the whole batch. The writer starts a batch with
+  bcb_recwrite, reserves records with bcb_recreserve and fills them in
+  place, then publishes all of them with bcb_recproduced. The reader starts
+  a batch with bcb_recread, walks the records with bcb_recnext, using them
+  in place, then gives all of them back with bcb_recconsumed. A batch only
+  sees the room or the records that were available when it started. Don't
+  mix records with the byte oriented functions on the same buffer.
+*/
+
+typedef struct Batch_t * batch_t;
+
+typedef struct Batch_t {          // A batch of records being written or read.
+  bcb_t                cb;
+  uint8_t *            at;        // Where the next record goes or comes from.
+  uint32_t             avail;     // Bytes left for this batch, as seen at its start.
+  uint32_t             num;       // Number of records in the batch so far.
+} Batch_t;
+
+#define BCBTOOBIG ((uint8_t *) -1)                           // A record that can never be reserved.
+
+void      bcb_recwrite(bcb_t cb, batch_t batch);
+uint8_t * bcb_recreserve(batch_t batch, uint32_t num);      // Returns NULL when there is no room for num bytes now, or BCBTOOBIG.
+void      bcb_recproduced(const Batch_t * batch);
+
+void      bcb_recread(bcb_t cb, batch_t batch);
+uint8_t * bcb_recnext(batch_t batch, uint32_t * num);       // Returns NULL when the batch has no more records.
+void      bcb_recconsumed(const Batch_t * batch);
+
+/*
+  Wait layer, in circbuffer-wait.c, for a reader that has nothing to do
+  while a Bcb_t is empty. bcb_wait first checks the buffer a number of
+  times, then it parks the reader; on Linux on a futex, elsewhere it yields
+  the processor between checks. The writer calls bcb_notify after it has
+  produced; that costs a fence and a load, and only when the reader is
+  parked, also a wake system call. So an idle pipeline costs no processor
+  time and a busy one no system calls. The futex word is a counter that is
+  bumped with each wake, so a wake between the last check of the reader and
+  the moment it parks, is never lost.
+*/
+
+typedef struct BWait_t * bwait_t;
+
+typedef struct BWait_t {          // Wait context for the reader of a circular byte buffer.
+  bcb_t                cb;
+  uint32_t             seq;       // Futex word; bumped by bcb_notify for a parked reader.
+  uint32_t             parked;    // Non zero while the reader is parked or about to park.
+  uint32_t             spins;     // Number of checks before parking.
+  uint32_t             wakes;     // Number of wake system calls issued.
+} BWait_t;
+
+void     bcb_waitinit(bwait_t wait, bcb_t cb, uint32_t spins);
+
+// Wait until there is something to read, or until ms milliseconds have
+// passed; 0 waits forever. Returns bcb_canread, i.e. 0 after a timeout.
+
+uint32_t bcb_wait(bwait_t wait, uint32_t ms);
+void     bcb_notify(bwait_t wait);
+
+/*
+  Mirrored mode, in circbuffer-mirror.c; needs mmap and memfd_create, so it
+  is only available on Linux. The buffer space is mapped twice, back to
+  back, so the byte after the last slot is the first slot again. Then
+  bcb_readslice and bcb_writeslice return all bytes that can be read or
+  written, as a single contiguous slice, also across the wrap point, and a
+  parser can work on a message in the buffer without copying it out first.
+  The usable size is rounded up, so that size + 1 is a multiple of the page
+  size. bcb_mirror returns NULL when the mappings can not be made; release
+  the buffer with bcb_unmirror. All other functions work as before.
+*/
+
+bcb_t    bcb_mirror(uint32_t size);
+void     bcb_unmirror(bcb_t cb);
+
+/*
+  Variant for 1 reader and 1 writer that run on different cores. In a Bcb_t,
+  get and put share a cache line, so each index update by one side evicts
+  that line from the other side, and volatile gives no ordering guarantees on
+  weakly ordered CPUs like ARM. In a Scb_t, the writer and the reader each
+  have their own cache line, holding the index they own and a shadow copy of
+  the index of the other side. The shadow is only refreshed, with acquire
+  semantics, when it makes the buffer look full for the writer or empty for
+  the reader; the own index is published with release semantics. So in
+  steady state, each side only touches the line of the other side once per
+  lap instead of once per slice.
+
+  The slice API is the same as for Bcb_t, but the slice functions need a non
+  const buffer since they update the shadow copies. A writeslice of 0 bytes
+  forces a refresh, so a writer that loops until it got enough room, always
+  sees the actual space eventually; the same goes for the reader. The buffer
+  space follows the structure; use scbsize to allocate it, on a cache line
+  boundary, e.g.
+
+    scb_t cb;
+    posix_memalign((void **) & cb, 64, scbsize(4096));
+    scb_init(cb, 4096);
+*/
+
+typedef struct Scb_t * scb_t;
+
+typedef struct Scb_t {            // Circular byte buffer, lock free for 1 reader and 1 writer on separate cores.
+  struct {                        // Owned by the writer.
+    uint8_t *          put;       // Next slot to write; stored with release semantics.
+    uint8_t *          get;       // Shadow copy of the reader get.
+    uint8_t            pad[64 - 2 * sizeof(uint8_t *)];
+  } __attribute__((aligned(64))) W;
+  struct {                        // Owned by the reader.
+    uint8_t *          get;       // Next slot to read; stored with release semantics.
+    uint8_t *          put;       // Shadow copy of the writer put.
+    uint8_t            pad[64 - 2 * sizeof(uint8_t *)];
+  } __attribute__((aligned(64))) R;
+  uint32_t             size;      // Read only after initialization; see Bcb_t for the meaning of these.
+  uint8_t              pad[4];
+  uint8_t *            wrap;
+  uint8_t *            end;
+  uint8_t              fill[64 - 8 - 2 * sizeof(uint8_t *)];
+  uint8_t              buff[];    // The buffer space, starting on a cache line.
+} __attribute__((aligned(64))) Scb_t;
+
+#define scbsize(N) (sizeof(Scb_t) + (N) + 1)                // Bytes required for a buffer of N usable bytes.
+
+void     scb_init(scb_t cb, uint32_t size);
+uint32_t scb_canread(const Scb_t * cb);
+uint32_t scb_canwrite(const Scb_t * cb);
+
+void     scb_readslice(scb_t cb, slice_t slice);
+void     scb_consumed(scb_t cb, const Slice_t * slice);
+void     scb_writeslice(scb_t cb, slice_t slice);
+void     scb_produced(scb_t cb, const Slice_t * slice);
+
+uint32_t scb_write(scb_t cb, const uint8_t data[], uint32_t num);
+uint32_t scb_read(scb_t cb, uint8_t data[], uint32_t num);
+
+/*
+  Ring for multiple writers and multiple readers. It moves records instead
+  of a byte stream, since bytes of different writers can not be interleaved
+  in a meaningful way. A writer reserves a record of a given size with
+  mcb_writeslice, fills it in place and publishes it with mcb_produced; a
+  reader claims the oldest record with mcb_readslice, uses it in place and
+  gives it back with mcb_consumed. So as for Bcb_t, no copies are needed.
+
+  Reservations are tickets on 4 monotonic byte counters, each on a cache
+  line of its own; writers reserve by advancing the reserve counter with a
+  compare and swap, so concurrent writers get disjoint regions, and readers
+  claim records by advancing the claim counter in the same way. Publishing
+  and giving back happen in ticket order: a writer waits until the writers
+  before it have published, then advances the commit counter; a reader
+  waits until the readers before it have given their records back, then
+  advances the release counter. While waiting, the contcb callback is
+  called; by default it does nothing, set it e.g. to yield the processor.
+  So a writer or reader that is descheduled between its reservation and
+  its publication, holds up the ones that come after it; keep that window
+  short.
+
+  Each record starts with an 8 byte header and is rounded up to 8 bytes.
+  A record is always contiguous; when it does not fit before the end of the
+  buffer, the tail is reserved as well and skipped. The size of the buffer
+  must be a power of 2 and at least 64 bytes; a record can be at most half
+  the size minus 8 bytes, so that, with a skipped tail, it still fits in an
+  empty ring. The buffer space follows the structure; use mcbsize to
+  allocate it, on a cache line boundary.
+*/
+
+typedef struct Mcb_t    * mcb_t;
+typedef struct MSlice_t * mslice_t;
+
+typedef void (*mcbfun_t)(mcb_t cb);
+
+typedef struct MCount_t {         // A ticket counter on a cache line of its own.
+  uint64_t             value;
+  uint8_t              pad[64 - sizeof(uint64_t)];
+} __attribute__((aligned(64))) MCount_t;
+
+typedef struct Mcb_t {            // Ring of records for many writers and readers; publication in ticket order.
+  MCount_t             reserve;   // Bytes reserved by writers so far.
+  MCount_t             commit;    // Bytes published by writers so far; readers can claim up to here.
+  MCount_t             claim;     // Bytes claimed by readers so far.
+  MCount_t             release;   // Bytes given back by readers so far; writers can reserve up to here + size.
+  uint32_t             size;      // Size of the buffer; a power of 2.
+  uint32_t             mask;      // Size minus 1.
+  mcbfun_t             contcb;    // Called while waiting for our turn; default does nothing.
+  uint8_t              fill[64 - 8 - sizeof(mcbfun_t)];
+  uint8_t              buff[];    // The buffer space, starting on a cache line.
+} __attribute__((aligned(64))) Mcb_t;
+
+typedef struct MSlice_t {         // A reserved or claimed record.
+  uint8_t *            data;      // Start of the record contents.
+  uint32_t             num;       // Number of bytes of the record contents.
+  uint32_t             span;      // Internal; number of bytes of the ring taken by this record.
+  uint64_t             at;        // Internal; ticket, i.e. the counter value at reservation or claim.
+} MSlice_t;
+
+#define mcbsize(N) (sizeof(Mcb_t) + (N))                    // Bytes required for a ring of N bytes.
+#define MCBTOOBIG  0xffffffffu                              // Returned for a record that can never be reserved.
+
+void     mcb_init(mcb_t cb, uint32_t size);
+
+// Reserve a record of num bytes; returns num, zero when there is not enough
+// room now, or MCBTOOBIG when num is 0 or more than size / 2 - 8, as that
+// will never succeed. A reserved record must be produced, with all its num
+// bytes.
+
+uint32_t mcb_writeslice(mcb_t cb, mslice_t slice, uint32_t num);
+void     mcb_produced(mcb_t cb, const MSlice_t * slice);
+
+// Claim the oldest published record; returns zero when there is none. A
+// claimed record must be consumed.
+
+uint32_t mcb_readslice(mcb_t cb, mslice_t slice);
+void     mcb_consumed(mcb_t cb, const MSlice_t * slice);
+
+// Copy a record in or out. mcb_write returns what mcb_writeslice returned;
+// only when that is num, the record was written. mcb_read returns the number of bytes copied, at most num; the
+// rest of a bigger record is dropped; it returns 0 when there is no record.
+
+uint32_t mcb_write(mcb_t cb, const uint8_t data[], uint32_t num);
+uint32_t mcb_read(mcb_t cb, uint8_t data[], uint32_t num);
+
 #endif // CIRCBUFFER_H
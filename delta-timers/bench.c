@@ -0,0 +1,830 @@
+// Copyright 2023 Steven Buytaert
+
+#include <stdio.h>
+#include <getopt.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sched.h>
+#include <pthread.h>
+#include <inttypes.h>
+
+#include <delta-timers.h>
+#include <tickless-ticker.h>
+
+/*
+
+  Benchmarks for the timer backends. The throughput scenarios run on a
+  simulated clock, so they only measure the cost of the timer code; the
+  accuracy scenario runs in real time, under a ticker thread.
+
+  The scenarios are
+    - churn:     modelled after request timeouts: a number of timers is live
+                 and nearly every one of them is cancelled before it elapses.
+                 Each operation cancels a random live timer and arms it
+                 again, with the same timeout relative to the current time,
+                 and every 16 operations, time advances with 1 unit. With -j,
+                 a random jitter is added to the timeout, so the list can no
+                 longer append at the end. The 16 cancels and their re-arms
+                 are timed apart, in the remove and rearm columns; the
+                 advances are not timed.
+    - uniform:   insert timers with a timeout spread uniformly up to -t, then
+                 advance, to the next wakeup each time, until all elapsed.
+    - bimodal:   the same, but 90% of the timers are short, up to 1/100 of
+                 -t, and the rest are long, between -t/2 and -t.
+    - cancelled: as uniform, but 95% of the timers are removed before time
+                 advances; the remove column is the cost of those.
+    - burst:     half of the timers is armed one by one, spread evenly up
+                 to -t, then the other half comes in as a burst, with
+                 random timeouts up to -t; each inserted on its own, then,
+                 on a fresh context, all with a single insertMany. Advances
+                 to the next wakeup each time and checks that every timer
+                 elapses exactly once, at its deadline.
+    - accuracy:  insert timers of 1 to 100 milliseconds, 1 millisecond apart,
+                 under the pthread ticker of the sample (-d ticker), polling
+                 at a fixed 1 millisecond and counting each timer from its
+                 insert, or the tickless driver (-d tickless), and report
+                 how late they elapse compared to when they were asked for,
+                 in real time, and the distribution of the overshoot
+                 argument. Timers that elapse early are reported as an
+                 error. As the pthread ticker can't be stopped, it only runs
+                 the first backend; pick another one with -b.
+    - shards:    -T threads arm timers of 1 to 64 units, round robin, on as
+                 many shards of delta-shards.c, each advanced by 1 unit at a
+                 time by its own owner thread; so every arm goes through an
+                 inbox. Compared with the same threads arming on one shared
+                 context, behind a mutex, advanced by a single ticker thread.
+                 Reports the cost per arm and how long it took until all
+                 timers elapsed, each exactly once. Runs on the linked and
+                 wheel backends, the ones a shard can have.
+
+  The backends are
+    - list:      initFTmrCtx; remove searches the list.
+    - linked:    initFTmrCtxLinked; remove uses the back-link.
+    - wheel:     initFTmrWheel.
+
+  There's no binary heap backend to compare with; it would go in the table
+  like the others.
+
+  A scenario stops a phase after 2 seconds, as the searching ones are slow
+  for many live timers; the number of operations done is reported. With -c,
+  the output is comma separated values, with a header line, to compare runs.
+
+  Build and run e.g. as
+
+    gcc -O2 -Wall -I . -o bench bench.c delta-timers.c delta-shards.c pthread-ticker.c tickless-ticker.c -lpthread
+    ./bench                       # All scenarios, 10k, 100k and 1M timers.
+    ./bench -s churn -n 50000 -j 1000 -b linked
+    ./bench -s accuracy -d tickless -c
+    ./bench -s shards -T 8 -b wheel -n 1000000
+
+*/
+
+typedef struct Backend_t {
+  const char * name;
+  void       (*init)(ftmrCtx_t ctx);
+} Backend_t;
+
+typedef struct Result_t {         // What a scenario measured; times in nanoseconds per operation.
+  uint64_t     ops;               // Number of timers or operations done.
+  double       insert;
+  double       remove;
+  double       rearm;             // Insert of a cancelled timer, for churn.
+  double       advance;           // Per elapsed timer, including the callback.
+  uint64_t     advances;          // Number of calls to advance.
+} Result_t;
+
+typedef struct Timer_t {          // Timer for the accuracy scenario.
+  FTmr_t       Tmr;
+  uint64_t     due;               // Monotonic time in ns it was asked to elapse at.
+  uint64_t     late;              // How late it elapsed, signed.
+  uint32_t     overshoot;
+  uint32_t     done;
+} Timer_t;
+
+static FTmrWheel_t Wheel;
+
+static void initWheel(ftmrCtx_t ctx) {
+  initFTmrWheel(ctx, & Wheel);
+}
+
+static const Backend_t Backends[] = {
+  { "list",   initFTmrCtx       },
+  { "linked", initFTmrCtxLinked },
+  { "wheel",  initWheel         },
+};
+
+static const char * Scenarios[] = { "churn", "uniform", "bimodal", "cancelled", "burst", "shards", "accuracy" };
+
+#define NUM(A) (sizeof(A) / sizeof(A[0]))
+
+static uint32_t timeout = 10000000; // Timeout of each timer, in units.
+static uint32_t jitter;             // Random extra timeout, when not 0.
+static uint64_t elapsed;            // Number of timers that elapsed.
+static uint32_t csv;                // Non zero for comma separated output.
+static uint64_t ops = 1000000;      // Number of churn operations.
+static uint32_t threads = 4;        // Number of arming threads and shards.
+
+static FTmrCtx_t       Ctx;         // Context for the accuracy scenario ...
+static pthread_mutex_t Mut = PTHREAD_MUTEX_INITIALIZER;  // ... with its lock.
+static pthread_mutex_t Clk = PTHREAD_MUTEX_INITIALIZER;  // Reading the time and advancing, or inserting, under the ticker.
+static uint64_t        base;        // Time in ns up to which the ticker advanced Ctx.
+
+void * ticker(void * mutref);       // Defined in pthread-ticker.c.
+
+static uint64_t now(void) {         // In nanoseconds.
+
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, & ts);
+
+  return (uint64_t) ts.tv_sec * 1000000000u + (uint64_t) ts.tv_nsec;
+
+}
+
+static uint32_t rnd(uint32_t * seed) {                      // Small xorshift generator, cheaper than rand().
+
+  *seed ^= *seed << 13;
+  *seed ^= *seed >> 17;
+  *seed ^= *seed << 5;
+
+  return *seed;
+
+}
+
+static void onElapsed(ftmrCtx_t ctx, ftmr_t tmr, uint32_t overshoot) {
+  (void) ctx; (void) tmr; (void) overshoot;
+  elapsed++;
+}
+
+static void arm(ftmrCtx_t ctx, ftmr_t tmr, uint32_t * seed) {
+
+  tmr->Time.abs = timeout + (jitter ? rnd(seed) % jitter : 0);
+  ctx->insert(ctx, tmr);
+
+}
+
+static int expired(uint64_t t0) {                           // Give up on slow ones.
+  return now() - t0 > 2000000000u;
+}
+
+static Result_t churn(const Backend_t * backend, FTmr_t T[], uint32_t live) {
+
+  FTmrCtx_t Ctx;
+  Result_t  R;
+  uint32_t  seed = 0x2545f491;
+  uint64_t  cancel = 0;
+  uint64_t  rearm = 0;
+  uint64_t  rearmed = 0;
+  uint64_t  t0;
+  uint64_t  t1;
+  uint64_t  t2;
+  uint64_t  t3;
+  uint32_t  i;
+  uint32_t  j;
+  uint32_t  k;
+  ftmr_t    tmr;
+  ftmr_t    B[16];                                          // Cancelled in this batch, to arm again.
+
+  memset(& R, 0x00, sizeof(R));
+  backend->init(& Ctx);
+
+  t0 = now();
+  for (i = 0; i < live; i++) {
+    initFTmr(& T[i], onElapsed);
+    arm(& Ctx, & T[i], & seed);
+    if (0 == (i % 16)) { Ctx.advance(& Ctx, 1); R.advances++; }  // Spread the expiries a bit.
+  }
+  R.insert = (double) (now() - t0) / (double) live;
+
+  t0 = now();
+  for (R.ops = 0; R.ops < ops; ) {
+    if (0 == (R.ops % 1024) && expired(t0)) { break; }
+    t1 = now();
+    for (j = 0, k = 0; j < 16 && R.ops < ops; j++, R.ops++) {
+      tmr = & T[rnd(& seed) % live];
+      if (Ctx.remove(& Ctx, tmr)) { B[k++] = tmr; }         // Picked twice in a batch is removed once.
+    }
+    t2 = now();
+    for (j = 0; j < k; j++) {
+      arm(& Ctx, B[j], & seed);
+    }
+    t3 = now();
+    cancel += t2 - t1;
+    rearm += t3 - t2;
+    rearmed += k;
+    Ctx.advance(& Ctx, 1); R.advances++;
+  }
+  R.remove = (double) cancel / (double) (R.ops ? R.ops : 1);
+  R.rearm = (double) rearm / (double) (rearmed ? rearmed : 1);
+
+  return R;
+
+}
+
+static Result_t population(const Backend_t * backend, FTmr_t T[], uint32_t num, uint32_t kind) {
+
+  FTmrCtx_t Ctx;
+  Result_t  R;
+  uint32_t  seed = 0x2545f491;
+  uint32_t  cancelled = 0;
+  uint64_t  t0;
+  uint32_t  i;
+  uint32_t  next;
+
+  memset(& R, 0x00, sizeof(R));
+  backend->init(& Ctx);
+  elapsed = 0;
+
+  t0 = now();
+  for (R.ops = 0; R.ops < num; R.ops++) {
+    if (0 == (R.ops % 1024) && expired(t0)) { break; }
+    initFTmr(& T[R.ops], onElapsed);
+    if (2 == kind && rnd(& seed) % 10) {                    // Bimodal, short ones.
+      T[R.ops].Time.abs = 1 + rnd(& seed) % (timeout / 100 + 1);
+    }
+    else if (2 == kind) {                                   // Bimodal, long ones.
+      T[R.ops].Time.abs = timeout / 2 + rnd(& seed) % (timeout / 2 + 1);
+    }
+    else {
+      T[R.ops].Time.abs = 1 + rnd(& seed) % timeout;
+    }
+    Ctx.insert(& Ctx, & T[R.ops]);
+  }
+  R.insert = (double) (now() - t0) / (double) (R.ops ? R.ops : 1);
+
+  if (3 == kind) {                                          // Mostly cancelled.
+    t0 = now();
+    for (i = 0; i < R.ops; i++) {
+      if (0 == (i % 1024) && expired(t0)) { break; }
+      if (rnd(& seed) % 100 < 95) {
+        Ctx.remove(& Ctx, & T[i]);
+        cancelled++;
+      }
+    }
+    R.remove = (double) (now() - t0) / (double) (cancelled ? cancelled : 1);
+    for ( ; i < R.ops; i++) {                               // Not timed; the rest of the 95%, to keep the population right.
+      if (rnd(& seed) % 100 < 95) { Ctx.remove(& Ctx, & T[i]); cancelled++; }
+    }
+  }
+
+  t0 = now();
+  for (next = Ctx.advance(& Ctx, 0); FTMRIDLE != next; R.advances++) {
+    next = Ctx.advance(& Ctx, next ? next : 1);             // Straight to the next wakeup, as a tickless driver would.
+  }
+  R.advance = (double) (now() - t0) / (double) (elapsed ? elapsed : 1);
+
+  if (elapsed + cancelled != R.ops) {
+    printf("%s: %"PRIu64" timers elapsed and %u were cancelled, out of %"PRIu64".\n", backend->name, elapsed, cancelled, R.ops);
+    exit(1);
+  }
+
+  return R;
+
+}
+
+static void report(const Backend_t * backend, const char * scenario, uint32_t num, const Result_t * R) {
+
+  if (csv) {
+    printf("%s,%s,%u,%"PRIu64",%.1f,%.1f,%.1f,%.1f,%"PRIu64"\n", scenario, backend->name, num, R->ops, R->insert, R->remove, R->rearm, R->advance, R->advances);
+  }
+  else if (! strcmp(scenario, "churn")) {
+    printf("%-9s %-7s %8u timers, %8"PRIu64" ops: insert %8.1f ns, remove %10.1f ns, rearm %8.1f ns, %"PRIu64" advances\n",
+      scenario, backend->name, num, R->ops, R->insert, R->remove, R->rearm, R->advances);
+  }
+  else {
+    printf("%-9s %-7s %8u timers, %8"PRIu64" ops: insert %8.1f ns, remove %10.1f ns, advance %8.1f ns per timer, %"PRIu64" advances\n",
+      scenario, backend->name, num, R->ops, R->insert, R->remove, R->advance, R->advances);
+  }
+
+}
+
+uint32_t tickisr(uint64_t ms) {                             // Called by the pthread ticker; polls at a fixed 1 ms.
+
+  uint64_t units;
+
+  (void) ms;                                                // Whole units of our own clock; the remainder counts for the next time.
+
+  pthread_mutex_lock(& Clk);
+  units = (now() - base) / 1000000u;
+  base += units * 1000000u;
+  (void) Ctx.advance(& Ctx, (uint32_t) units);              // Not sleeping until the next wakeup, unlike the sample, ...
+  pthread_mutex_unlock(& Clk);
+
+  return 1;                                                 // ... as inserts from the main thread can't wake it up.
+
+}
+
+static uint32_t tmrlock(ftmrCtx_t ctx, uint32_t lock) {
+
+  (void) ctx;
+
+  if (lock) {
+    pthread_mutex_lock(& Mut);
+  }
+  else {
+    pthread_mutex_unlock(& Mut);
+  }
+
+  return 0;
+
+}
+
+static void onTimer(ftmrCtx_t ctx, ftmr_t tmr, uint32_t overshoot) {
+
+  Timer_t * t = (Timer_t *) tmr;
+
+  (void) ctx;
+
+  t->late = now() - t->due;                                 // Wraps around when early; read as signed.
+  t->overshoot = overshoot;
+  __atomic_store_n(& t->done, 1, __ATOMIC_RELEASE);
+
+}
+
+static int cmp(const void * a, const void * b) {
+  int64_t x = *(const int64_t *) a;
+  int64_t y = *(const int64_t *) b;
+  return (x > y) - (x < y);
+}
+
+static void accuracy(const Backend_t * backend, const char * driver, uint32_t num) {
+
+  static FTick_t Tick;
+  pthread_t      thread;
+  Timer_t *      T = calloc(num, sizeof(Timer_t));
+  int64_t *      late = calloc(num, sizeof(int64_t));
+  uint64_t       hist[8] = { 0 };                           // Overshoot 0, 1, 2, 3 to 4, 5 to 8, ... units.
+  uint32_t       seed = 0x2545f491;
+  uint32_t       tickless = ! strcmp(driver, "tickless");
+  uint32_t       i;
+  uint32_t       b;
+
+  if (! T || ! late) { printf("Out of memory.\n"); exit(1); }
+
+  backend->init(& Ctx);
+  Ctx.locker = tmrlock;
+
+  if (tickless) {
+    if (! initFTick(& Tick, & Ctx, 1000000)) { printf("No tickless driver.\n"); exit(1); }
+    pthread_create(& thread, NULL, ftickRun, & Tick);
+  }
+  else {
+    base = now();
+    pthread_create(& thread, NULL, ticker, & Mut);          // Never stops; it goes with the process.
+  }
+
+  for (i = 0; i < num; i++) {
+    struct timespec Pause = { 0, 1000000 };
+    initFTmr(& T[i].Tmr, onTimer);
+    T[i].Tmr.Time.abs = 1 + rnd(& seed) % 100;
+    T[i].due = now() + T[i].Tmr.Time.abs * 1000000u;
+    if (tickless) {
+      ftickInsert(& Tick, & T[i].Tmr);
+    }
+    else {                                                  // Count from now, not the last tick; as ftickInsert does.
+      pthread_mutex_lock(& Clk);
+      T[i].Tmr.Time.abs += (uint32_t) ((now() - base + 999999u) / 1000000u);
+      Ctx.insert(& Ctx, & T[i].Tmr);
+      pthread_mutex_unlock(& Clk);
+    }
+    nanosleep(& Pause, NULL);
+  }
+
+  for (i = 0; i < num; i++) {
+    while (! __atomic_load_n(& T[i].done, __ATOMIC_ACQUIRE)) {
+      struct timespec Pause = { 0, 1000000 };
+      nanosleep(& Pause, NULL);
+    }
+    late[i] = (int64_t) T[i].late;
+    b = T[i].overshoot < 4 ? T[i].overshoot : 2 + (32 - (uint32_t) __builtin_clz(T[i].overshoot - 1));
+    hist[b < 7 ? b : 7]++;
+  }
+
+  if (tickless) {
+    ftickStop(& Tick);
+    pthread_join(thread, NULL);
+  }
+
+  qsort(late, num, sizeof(int64_t), cmp);
+
+  for (i = 0; i < num && late[i] < 0; i++) { }
+  if (i) {
+    fprintf(stderr, "accuracy: %u of %u timers elapsed early under the %s.\n", i, num, driver);
+  }
+
+  if (csv) {
+    printf("accuracy,%s/%s,%u,%"PRId64",%"PRId64",%"PRId64",%"PRId64, backend->name, driver, num,
+      late[0] / 1000, late[num / 2] / 1000, late[num * 99 / 100] / 1000, late[num - 1] / 1000);
+    for (b = 0; b < NUM(hist); b++) { printf(",%"PRIu64, hist[b]); }
+    printf("\n");
+  }
+  else {
+    printf("accuracy  %-7s %8u timers under the %s: late min %"PRId64" us, median %"PRId64" us, 99%% %"PRId64" us, max %"PRId64" us\n",
+      backend->name, num, driver, late[0] / 1000, late[num / 2] / 1000, late[num * 99 / 100] / 1000, late[num - 1] / 1000);
+    printf("          overshoot 0: %"PRIu64", 1: %"PRIu64", 2: %"PRIu64", 3-4: %"PRIu64", 5-8: %"PRIu64", 9-16: %"PRIu64", 17-32: %"PRIu64", more: %"PRIu64"\n",
+      hist[0], hist[1], hist[2], hist[3], hist[4], hist[5], hist[6], hist[7]);
+  }
+
+  free(T);
+  free(late);
+
+}
+
+typedef struct Arming_t {         // An arming thread of the shards scenario.
+  pthread_t    thread;
+  uint32_t     from;              // Arms timers from ...
+  uint32_t     to;                // ... up to this one.
+  uint64_t     ns;                // Time it took.
+} Arming_t;
+
+static FTmr_t *      Armed;         // Timers of the burst and shards scenarios, ...
+static uint8_t *     Hits;          // ... how many times each elapsed ...
+static uint32_t      numArmed;      // ... and how many there are.
+static uint32_t      Fired;         // Number of timers that elapsed; atomic.
+static uint32_t      Go;            // Set to start all threads at once.
+static FTmrShard_t * Shards;        // The shards, or NULL to arm on Shared.
+static FTmrCtx_t     Shared;        // The context shared by all threads.
+static uint64_t *    Due;           // Deadline of each burst timer ...
+static uint64_t      Clock;         // ... against the units advanced so far.
+static uint32_t      Missed;        // Number of burst timers that elapsed off their deadline.
+
+static void onBurst(ftmrCtx_t ctx, ftmr_t tmr, uint32_t overshoot) {
+  (void) ctx;
+  Hits[tmr - Armed]++;
+  Fired++;
+  if (Clock - overshoot != Due[tmr - Armed]) { Missed++; }
+}
+
+static double burstPhase(const Backend_t * backend, ftmr_t P[], uint32_t num, uint32_t * inBurst, uint32_t many) {
+
+  FTmrCtx_t Ctx;
+  uint32_t  half = num / 2;
+  uint32_t  done;
+  uint64_t  t0;
+  uint64_t  ns;
+  uint32_t  i;
+  uint32_t  next;
+
+  backend->init(& Ctx);
+  memset(Hits, 0x00, num);
+  Fired = 0;
+  Missed = 0;
+  Clock = 0;
+
+  for (i = 0; i < num; i++) {
+    initFTmr(& Armed[i], onBurst);
+    Armed[i].Time.abs = Due[i];
+    if (i < half) { Ctx.insert(& Ctx, & Armed[i]); }        // In increasing order, so the list only appends.
+  }
+
+  if (many) {
+    for (i = 0; i < *inBurst; i++) { P[i] = & Armed[half + i]; }
+    t0 = now();
+    Ctx.insertMany(& Ctx, P, *inBurst);
+    ns = now() - t0;
+  }
+  else {
+    t0 = now();
+    for (i = 0; i < num - half; i++) {
+      if (0 == (i % 1024) && expired(t0)) { break; }
+      Ctx.insert(& Ctx, & Armed[half + i]);
+    }
+    ns = now() - t0;
+    *inBurst = i;                                           // The insertMany phase takes as many.
+  }
+
+  done = half + *inBurst;
+
+  for (next = Ctx.advance(& Ctx, 0); FTMRIDLE != next; ) {
+    Clock += next ? next : 1;                               // Before the callbacks, that compare with it.
+    next = Ctx.advance(& Ctx, next ? next : 1);
+  }
+
+  for (i = 0; i < done; i++) {
+    if (1 != Hits[i]) {
+      printf("burst: %s: timer %u elapsed %u times.\n", backend->name, i, Hits[i]);
+      exit(1);
+    }
+  }
+
+  if (Missed || Fired != done) {
+    printf("burst: %s: %u of %u timers elapsed off their deadline.\n", backend->name, Missed, Fired);
+    exit(1);
+  }
+
+  return (double) ns / (double) (*inBurst ? *inBurst : 1);
+
+}
+
+static void burst(const Backend_t * backend, FTmr_t T[], uint32_t num) {
+
+  ftmr_t * P = calloc(num, sizeof(ftmr_t));
+  uint32_t seed = 0x2545f491;
+  uint32_t half = num / 2;
+  uint32_t inBurst = 0;
+  double   single;
+  double   many;
+  uint32_t i;
+
+  Armed = T;
+  Hits = calloc(num, 1);
+  Due = calloc(num, sizeof(uint64_t));
+
+  if (! P || ! Hits || ! Due) { printf("Out of memory.\n"); exit(1); }
+
+  for (i = 0; i < num; i++) {
+    Due[i] = i < half ? 1 + (uint64_t) i * timeout / half : 1 + rnd(& seed) % timeout;
+  }
+
+  single = burstPhase(backend, P, num, & inBurst, 0);
+  many = burstPhase(backend, P, num, & inBurst, 1);
+
+  if (csv) {
+    printf("burst,%s,%u,%u,%.1f,%.1f\n", backend->name, num, inBurst, single, many);
+  }
+  else {
+    printf("burst     %-7s %8u timers, %8u in the burst: insert %8.1f ns, insertMany %8.1f ns per timer\n",
+      backend->name, num, inBurst, single, many);
+  }
+
+  free(P);
+  free(Hits);
+  free(Due);
+  Hits = NULL;
+
+}
+
+static void onArmed(ftmrCtx_t ctx, ftmr_t tmr, uint32_t overshoot) {
+  (void) ctx; (void) overshoot;
+  Hits[tmr - Armed]++;
+  __atomic_add_fetch(& Fired, 1, __ATOMIC_RELAXED);
+}
+
+static void waitGo(void) {
+  while (! __atomic_load_n(& Go, __ATOMIC_ACQUIRE)) { sched_yield(); }
+}
+
+static void * owner(void * arg) {                           // Ticker of a shard; it advances, 1 unit at a time, until all elapsed.
+
+  ftmrShard_t shard = arg;
+
+  ftmrShardBind(shard);
+  waitGo();
+  while (__atomic_load_n(& Fired, __ATOMIC_RELAXED) < numArmed) {
+    ftmrShardAdvance(shard, 1);
+    sched_yield();
+  }
+
+  return NULL;
+
+}
+
+static void * sharedTicker(void * arg) {                    // The same, for the shared context.
+
+  (void) arg;
+
+  waitGo();
+  while (__atomic_load_n(& Fired, __ATOMIC_RELAXED) < numArmed) {
+    Shared.advance(& Shared, 1);
+    sched_yield();
+  }
+
+  return NULL;
+
+}
+
+static void * arming(void * arg) {
+
+  Arming_t * a = arg;
+  uint32_t   seed = 0x2545f491 + a->from;
+  uint64_t   t0;
+  uint32_t   i;
+
+  waitGo();
+  t0 = now();
+  for (i = a->from; i < a->to; i++) {
+    Armed[i].Time.abs = 1 + rnd(& seed) % 64;
+    if (Shards) {
+      ftmrShardArm(& Shards[i % threads], & Armed[i]);
+    }
+    else {
+      Shared.insert(& Shared, & Armed[i]);
+    }
+  }
+  a->ns = now() - t0;
+
+  return NULL;
+
+}
+
+static void shards(const Backend_t * backend, uint32_t num, uint32_t sharded) {
+
+  FTmrWheel_t * W = NULL;
+  Arming_t *    A = calloc(threads, sizeof(Arming_t));
+  pthread_t *   O = calloc(threads, sizeof(pthread_t));
+  uint32_t      wheel = ! strcmp(backend->name, "wheel");
+  uint32_t      owners = sharded ? threads : 1;
+  uint64_t      foreign = 0;
+  uint64_t      ns = 0;
+  uint64_t      t0;
+  uint32_t      i;
+
+  Armed = calloc(num, sizeof(FTmr_t));
+  Hits = calloc(num, 1);
+  numArmed = num;
+  Fired = 0;
+  Go = 0;
+  Shards = NULL;
+
+  if (sharded) {
+    Shards = aligned_alloc(64, threads * sizeof(FTmrShard_t));
+    W = wheel ? calloc(threads, sizeof(FTmrWheel_t)) : NULL;
+  }
+
+  if (! A || ! O || ! Armed || ! Hits || (sharded && ! Shards) || (wheel && sharded && ! W)) { printf("Out of memory.\n"); exit(1); }
+
+  for (i = 0; i < num; i++) {
+    initFTmr(& Armed[i], onArmed);
+  }
+
+  if (sharded) {
+    for (i = 0; i < threads; i++) {
+      initFTmrShard(& Shards[i], W ? & W[i] : NULL);
+      pthread_create(& O[i], NULL, owner, & Shards[i]);
+    }
+  }
+  else {
+    backend->init(& Shared);
+    Shared.locker = tmrlock;
+    pthread_create(& O[0], NULL, sharedTicker, NULL);
+  }
+
+  for (i = 0; i < threads; i++) {
+    A[i].from = (uint32_t) ((uint64_t) num * i / threads);
+    A[i].to = (uint32_t) ((uint64_t) num * (i + 1) / threads);
+    pthread_create(& A[i].thread, NULL, arming, & A[i]);
+  }
+
+  t0 = now();
+  __atomic_store_n(& Go, 1, __ATOMIC_RELEASE);
+
+  for (i = 0; i < threads; i++) {
+    pthread_join(A[i].thread, NULL);
+    ns += A[i].ns;
+  }
+  for (i = 0; i < owners; i++) {
+    pthread_join(O[i], NULL);
+  }
+  t0 = now() - t0;
+
+  for (i = 0; i < num; i++) {
+    if (1 != Hits[i]) {
+      printf("shards: timer %u elapsed %u times.\n", i, Hits[i]);
+      exit(1);
+    }
+  }
+
+  for (i = 0; sharded && i < threads; i++) {
+    foreign += Shards[i].foreign;
+  }
+
+  if (csv) {
+    printf("shards,%s/%s,%u,%u,%.1f,%.3f,%"PRIu64"\n", backend->name, sharded ? "sharded" : "shared", threads, num,
+      (double) ns / (double) num, (double) t0 / 1e6, foreign);
+  }
+  else {
+    printf("shards    %-7s %8u timers, %s by %u threads: arm %8.1f ns, all elapsed after %8.3f ms, %"PRIu64" through an inbox\n",
+      backend->name, num, sharded ? "sharded" : "shared ", threads, (double) ns / (double) num, (double) t0 / 1e6, foreign);
+  }
+
+  free(A);
+  free(O);
+  free(W);
+  free(Shards);
+  free(Armed);
+  free(Hits);
+  Shards = NULL;
+
+}
+
+static struct option long_options[] = {
+  { "backend",    1, NULL, 'b' },
+  { "scenario",   1, NULL, 's' },
+  { "live",       1, NULL, 'n' },
+  { "ops",        1, NULL, 'o' },
+  { "timeout",    1, NULL, 't' },
+  { "jitter",     1, NULL, 'j' },
+  { "driver",     1, NULL, 'd' },
+  { "threads",    1, NULL, 'T' },
+  { "csv",        0, NULL, 'c' },
+  { "help",       0, NULL, 'h' },
+  { NULL,         0, NULL,  0  }
+};
+
+int main(int argc, char * argv[]) {
+
+  const char * only = NULL;
+  const char * scenario = NULL;
+  const char * driver = "ticker";
+  uint32_t     live = 0;
+  uint32_t     n;
+  uint32_t     s;
+  uint32_t     i;
+  FTmr_t *     T;
+  Result_t     R;
+  int          c;
+
+  while ((c = getopt_long(argc, argv, "b:s:n:o:t:j:d:T:ch", long_options, NULL)) != -1) {
+    switch (c) {
+      case 'b': only = optarg; break;
+      case 's': scenario = optarg; break;
+      case 'n': live = (uint32_t) atoi(optarg); break;
+      case 'o': ops = (uint64_t) atoll(optarg); break;
+      case 't': timeout = (uint32_t) atoi(optarg); break;
+      case 'j': jitter = (uint32_t) atoi(optarg); break;
+      case 'd': driver = optarg; break;
+      case 'T': threads = (uint32_t) atoi(optarg); break;
+      case 'c': csv = 1; break;
+      case 'h':
+      default: {
+        printf("--backend    -b : only run the given backend.\n");
+        printf("--scenario   -s : only run the given scenario.\n");
+        printf("--live       -n : number of timers; default 10k, 100k and 1M; 1000 for accuracy, 10k for shards.\n");
+        printf("--ops        -o : number of churn operations; default %"PRIu64".\n", ops);
+        printf("--timeout    -t : (maximum) timeout in units; default %u.\n", timeout);
+        printf("--jitter     -j : random extra timeout in units for churn; default %u.\n", jitter);
+        printf("--driver     -d : ticker or tickless, for accuracy; default %s.\n", driver);
+        printf("--threads    -T : arming threads and shards, for shards; default %u.\n", threads);
+        printf("--csv        -c : comma separated output.\n");
+        exit(0);
+      }
+    }
+  }
+
+  if (threads < 1) {
+    printf("There must be at least 1 arming thread.\n");
+    exit(1);
+  }
+
+  if (timeout < 2 || (live ? live : 1000000u) / 16 + ops / 16 >= timeout) {
+    printf("The timeout must be larger than the time churn advances, or timers would elapse.\n");
+    exit(1);
+  }
+
+  if (csv && (! scenario || (strcmp(scenario, "accuracy") && strcmp(scenario, "shards") && strcmp(scenario, "burst")))) {
+    printf("scenario,backend,timers,ops,insert_ns,remove_ns,rearm_ns,advance_ns,advances\n");
+  }
+
+  for (s = 0; s < NUM(Scenarios); s++) {
+    if (scenario && strcmp(scenario, Scenarios[s])) { continue; }
+    if (! strcmp(Scenarios[s], "burst")) {                  // Single inserts against insertMany.
+      if (csv) { printf("scenario,backend,timers,burst,insert_ns,insertmany_ns\n"); }
+      for (n = live ? live : 10000; n <= (live ? live : 1000000u); n *= 10) {
+        T = calloc(n, sizeof(FTmr_t));
+        if (! T) { printf("Out of memory.\n"); exit(1); }
+        for (i = 0; i < NUM(Backends); i++) {
+          if (! only || ! strcmp(only, Backends[i].name)) {
+            burst(& Backends[i], T, n);
+          }
+        }
+        free(T);
+      }
+      continue;
+    }
+    if (! strcmp(Scenarios[s], "shards")) {                 // Threads, in real time.
+      if (csv) { printf("scenario,backend/mode,threads,timers,arm_ns,elapsed_ms,foreign\n"); }
+      for (i = 0; i < NUM(Backends); i++) {
+        if (Backends[i].init != initFTmrCtx && (! only || ! strcmp(only, Backends[i].name))) {
+          shards(& Backends[i], live ? live : 10000, 0);
+          shards(& Backends[i], live ? live : 10000, 1);
+        }
+      }
+      continue;
+    }
+    if (! strcmp(Scenarios[s], "accuracy")) {               // Accuracy, in real time.
+      if (csv) { printf("scenario,backend/driver,timers,late_min_us,late_median_us,late_99_us,late_max_us,o0,o1,o2,o3_4,o5_8,o9_16,o17_32,more\n"); }
+      for (i = 0; i < NUM(Backends); i++) {
+        if (! only || ! strcmp(only, Backends[i].name)) {
+          accuracy(& Backends[i], driver, live ? live : 1000);
+          if (strcmp(driver, "tickless")) { break; }        // The pthread ticker never stops, so only the first one.
+        }
+      }
+      continue;
+    }
+    for (n = live ? live : 10000; n <= (live ? live : 1000000u); n *= 10) {
+      T = calloc(n, sizeof(FTmr_t));
+      if (! T) { printf("Out of memory.\n"); exit(1); }
+      for (i = 0; i < NUM(Backends); i++) {
+        if (! only || ! strcmp(only, Backends[i].name)) {
+          R = s ? population(& Backends[i], T, n, s) : churn(& Backends[i], T, n);
+          report(& Backends[i], Scenarios[s], n, & R);
+        }
+      }
+      free(T);
+    }
+  }
+
+  return 0;
+
+}
@@ -0,0 +1,87 @@
+// Copyright (c) 2022-2023 Steven Buytaert
+
+#define _GNU_SOURCE
+
+#include <sched.h>
+#include <assert.h>
+
+#include <delta-timers.h>
+
+static __thread ftmrShard_t Local;                          // Shard owned by this thread, if any.
+
+void initFTmrShard(ftmrShard_t shard, ftmrWheel_t wheel) {
+
+  if (wheel) {
+    initFTmrWheel(& shard->Ctx, wheel);
+  }
+  else {
+    initFTmrCtxLinked(& shard->Ctx);                        // Cancelling is common, so the O(1) remove.
+  }
+
+  shard->inbox   = NULL;
+  shard->foreign = 0;
+
+}
+
+void ftmrShardBind(ftmrShard_t shard) {
+  Local = shard;
+}
+
+ftmrShard_t ftmrShardLocal(void) {
+  return Local;
+}
+
+ftmrShard_t ftmrShardPick(FTmrShard_t shards[], uint32_t num) {
+
+  int cpu = 0;
+
+  if (Local) { return Local; }
+
+#if defined(__linux__)
+  cpu = sched_getcpu();
+  if (cpu < 0) { cpu = 0; }
+#endif // __linux__
+
+  return & shards[(uint32_t) cpu % num];
+
+}
+
+void ftmrShardArm(ftmrShard_t shard, ftmr_t tmr) {
+
+  ftmr_t head;
+
+  if (Local == shard) {                                     // The owner; no need to go through the inbox.
+    shard->Ctx.insert(& shard->Ctx, tmr);
+    return;
+  }
+
+  head = __atomic_load_n(& shard->inbox, __ATOMIC_RELAXED);
+  do {
+    tmr->next = head;
+  } while (! __atomic_compare_exchange_n(& shard->inbox, & head, tmr, 1, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+
+}
+
+uint32_t ftmrShardAdvance(ftmrShard_t shard, uint32_t delta) {
+
+  ftmr_t   tmr;
+  ftmr_t   next;
+  uint32_t wakeup;
+
+  assert(Local == shard);                                   // Only the owner advances.
+
+  wakeup = shard->Ctx.advance(& shard->Ctx, delta);
+
+  if (__atomic_load_n(& shard->inbox, __ATOMIC_RELAXED)) {  // Take all of the inbox at once; pushers only ever see an empty or a full one.
+    tmr = __atomic_exchange_n(& shard->inbox, NULL, __ATOMIC_ACQUIRE);
+    for ( ; tmr; tmr = next) {
+      next = tmr->next;
+      shard->Ctx.insert(& shard->Ctx, tmr);
+      shard->foreign++;
+    }
+    wakeup = shard->Ctx.advance(& shard->Ctx, 0);           // The inbox can hold earlier timers; this elapses nothing that isn't due yet.
+  }
+
+  return wakeup;
+
+}
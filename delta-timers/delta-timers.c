@@ -1,4 +1,6 @@
 #include <string.h>
+#include <stdlib.h>
+#include <stddef.h>
 #include <assert.h>
 
 // Copyright (c) 2022-2023 Steven Buytaert
@@ -19,7 +21,7 @@ static void insertFTmr(ctx_t ctx, tmr_t tmr) {              // Insert a timer in
 
   tmr_t    c;                                               // Cursor over the list of timers.
   tmr_t *  u;                                               // Location to update with our new timer.
-  uint32_t to = tmr->Time.abs + ctx->advDelta;              // Get the absolute timeout; ctx->advDelta set during advance function below.
+  uint32_t to;                                              // The absolute timeout.
 
   struct {
     uint32_t c;                                             // Absolute timout at cursor 'c'.
@@ -28,18 +30,22 @@ static void insertFTmr(ctx_t ctx, tmr_t tmr) {              // Insert a timer in
 
   ctx->locker(ctx, 1);                                      // Lock.
 
-  if (tmr->Time.abs >= ctx->Last.abs) {                     // See if we can skip the search for an insertion point.
+  to = tmr->Time.abs + ctx->advDelta;                       // Inside the lock; ctx->advDelta set during advance function below.
+
+  if (to >= ctx->Last.abs) {                                // See if we can skip the search for an insertion point.
     tmr->next = NULL;
     if (ctx->Last.timer) {
       ctx->Last.timer->next = tmr;                          // Link timer in.
+      tmr->pprev = & ctx->Last.timer->next;
     }
     else {
       assert(! ctx->timers);                                // There's no timer yet ...
       assert(0 == ctx->Last.abs);                           // ... and total timeout is 0, ...
       ctx->timers = tmr;                                    // ... so this one becomes the first.
+      tmr->pprev = & ctx->timers;
     }
     ctx->Last.timer = tmr;
-    tmr->Time.abs -= ctx->Last.abs;
+    tmr->Time.rel = to - ctx->Last.abs;
     ctx->Last.abs += tmr->Time.rel;
   }
   else {
@@ -47,11 +53,22 @@ static void insertFTmr(ctx_t ctx, tmr_t tmr) {              // Insert a timer in
     for (c = *u; c; u = & c->next, c = c->next) {             // Walk over the list, keeping track of update location.
       Time.c += c->Time.rel;
       if (Time.c >= to) {
+        if (Time.c - to <= tmr->slack) {                      // Within the slack of this timer, so share the expiry of 'c'.
+          tmr->slack -= Time.c - to;                          // What's left of the slack, for the wakeup.
+          to = Time.c;
+          Time.u = Time.c;
+          u = & c->next;
+        }
         tmr->next = u[0]; u[0] = tmr;                         // Link the timer in the list.
+        tmr->pprev = u;
         tmr->Time.rel = to - Time.u;                          // Write back the relative timeout.
         if (tmr->next) {                                      // If there is a next timer, also update its relative timeout.
           assert(tmr->next->Time.rel >= tmr->Time.rel);       // If this fires, somethings wrong in the lines above.
           tmr->next->Time.rel -= tmr->Time.rel;
+          tmr->next->pprev = & tmr->next;
+        }
+        else {
+          ctx->Last.timer = tmr;                              // Aligned with the last one; Last.abs stays the same.
         }
         break;                                                // Timer inserted, we can stop.
       }
@@ -60,6 +77,7 @@ static void insertFTmr(ctx_t ctx, tmr_t tmr) {              // Insert a timer in
 
     if (! c) {                                                // We've reached the end of the list without find the insertion point ...
       u[0] = tmr; tmr->next = NULL;                           // ... so insert at the end ...
+      tmr->pprev = u;
       tmr->Time.rel = to - Time.c;                            // ... with the proper timeout.
       ctx->Last.abs += tmr->Time.rel;
       ctx->Last.timer = tmr;
@@ -71,6 +89,84 @@ static void insertFTmr(ctx_t ctx, tmr_t tmr) {              // Insert a timer in
 
 }
 
+static int byTimeout(const void * a, const void * b) {      // Order timer references by Time.abs.
+
+  const uint64_t x = (* (const tmr_t *) a)->Time.abs;
+  const uint64_t y = (* (const tmr_t *) b)->Time.abs;
+
+  return (x > y) - (x < y);
+
+}
+
+static void insertMany(ctx_t ctx, tmr_t tmrs[], uint32_t num) {  // Sort the timers, then merge them into the list in a single pass.
+
+  tmr_t    c;                                               // Cursor over the list of timers; the first one not before 'to'.
+  tmr_t *  u;                                               // Location to update with the next new timer.
+  tmr_t    tmr;
+  uint64_t at = 0;                                          // Absolute timeout at update location 'u'.
+  uint64_t to;
+  uint32_t i;
+
+  qsort(tmrs, num, sizeof(tmr_t), byTimeout);               // Outside the lock; adding advDelta doesn't change the order.
+
+  ctx->locker(ctx, 1);                                      // Lock.
+
+  u = & ctx->timers;
+  c = *u;
+
+  for (i = 0; i < num; i++) {
+    tmr = tmrs[i];
+    to = tmr->Time.abs + ctx->advDelta;
+    if (to >= ctx->Last.abs) { break; }                     // This and the rest go to the tail; see below.
+    while (c && at + c->Time.rel < to) {                    // Move the cursor up to the insertion point; it never goes back.
+      at += c->Time.rel;
+      u = & c->next;
+      c = c->next;
+    }
+    assert(c);                                              // As to < Last.abs.
+    if (at + c->Time.rel - to <= tmr->slack) {              // Within the slack of this timer, so share the expiry of 'c'.
+      tmr->slack -= (uint32_t) (at + c->Time.rel - to);
+      tmr->next = c->next; c->next = tmr;                   // Link it in right after 'c', but leave the cursor, as the
+      tmr->pprev = & c->next;                               // next timers can still go before 'c'.
+      tmr->Time.rel = 0;
+      if (tmr->next) {
+        tmr->next->pprev = & tmr->next;
+      }
+      else {
+        ctx->Last.timer = tmr;                              // Aligned with the last one; Last.abs stays the same.
+      }
+      continue;
+    }
+    tmr->next = c; u[0] = tmr;                              // Link the timer in the list.
+    tmr->pprev = u;
+    tmr->Time.rel = to - at;
+    c->Time.rel -= tmr->Time.rel;
+    c->pprev = & tmr->next;
+    u = & tmr->next;                                        // The next one goes after this one.
+    at = to;
+  }
+
+  for ( ; i < num; i++) {                                   // The tail segment; the same shortcut as for a single insert.
+    tmr = tmrs[i];
+    to = tmr->Time.abs + ctx->advDelta;
+    tmr->next = NULL;
+    if (ctx->Last.timer) {
+      ctx->Last.timer->next = tmr;
+      tmr->pprev = & ctx->Last.timer->next;
+    }
+    else {
+      ctx->timers = tmr;
+      tmr->pprev = & ctx->timers;
+    }
+    ctx->Last.timer = tmr;
+    tmr->Time.rel = to - ctx->Last.abs;
+    ctx->Last.abs = to;
+  }
+
+  ctx->locker(ctx, 0);                                      // Unlock.
+
+}
+
 static tmr_t removeFTmr(ctx_t ctx, tmr_t tmr) {             // Remove a timer from the linked list in the context.
 
   tmr_t   c;                                                // Cursor over the list of timers.
@@ -86,11 +182,13 @@ static tmr_t removeFTmr(ctx_t ctx, tmr_t tmr) {             // Remove a timer fr
       u[0] = tmr->next;
       if (tmr->next) {
         tmr->next->Time.rel += tmr->Time.rel;               // Update the next timer.
+        tmr->next->pprev = u;
       }
       else {
         ctx->Last.abs -= tmr->Time.rel;                     // If no next timer, update the absolute timeout.
         ctx->Last.timer = p;
       }
+      tmr->pprev = NULL;
       break;                                                // Found the timer so quit searching.
     }
   }
@@ -101,6 +199,32 @@ static tmr_t removeFTmr(ctx_t ctx, tmr_t tmr) {             // Remove a timer fr
 
 }
 
+static tmr_t removeLinked(ctx_t ctx, tmr_t tmr) {           // Remove a timer in O(1), via its back-link.
+
+  tmr_t r = NULL;
+
+  ctx->locker(ctx, 1);                                      // Lock.
+
+  if (tmr->pprev) {                                         // Not NULL means it's in the list.
+    tmr->pprev[0] = tmr->next;
+    if (tmr->next) {
+      tmr->next->Time.rel += tmr->Time.rel;                 // Update the next timer.
+      tmr->next->pprev = tmr->pprev;
+    }
+    else {                                                  // The last one; the new last is the timer that holds pprev, if any.
+      ctx->Last.abs -= tmr->Time.rel;
+      ctx->Last.timer = tmr->pprev == & ctx->timers ? NULL : (tmr_t) ((uint8_t *) tmr->pprev - offsetof(FTmr_t, next));
+    }
+    tmr->pprev = NULL;
+    r = tmr;
+  }
+
+  ctx->locker(ctx, 0);                                      // Unlock.
+
+  return r;
+
+}
+
 static void doFlock(ctx_t ctx, Flock_t F[], uint32_t num) { // Call the elapse functions for timers in a flock.
 
   uint32_t i;
@@ -111,7 +235,27 @@ static void doFlock(ctx_t ctx, Flock_t F[], uint32_t num) { // Call the elapse f
 
 }
 
-static void advanceTmr(ftmrCtx_t ctx, uint32_t delta) {     // Advance the timeout, elapsing timers that timed out, if any.
+static uint32_t wakeup(ctx_t ctx) {                         // Units until the earliest expiry plus slack of the list.
+
+  tmr_t    c;
+  uint64_t at = 0;                                          // Absolute timeout at cursor 'c'.
+  uint64_t next = FTMRIDLE;
+
+  ctx->locker(ctx, 1);                                      // Lock.
+
+  for (c = ctx->timers; c; c = c->next) {
+    at += c->Time.rel;
+    if (at >= next) { break; }                              // Timers from here on can't make it earlier.
+    if (at + c->slack < next) { next = at + c->slack; }
+  }
+
+  ctx->locker(ctx, 0);                                      // Unlock.
+
+  return (uint32_t) next;
+
+}
+
+static uint32_t advanceTmr(ftmrCtx_t ctx, uint32_t delta) { // Advance the timeout, elapsing timers that timed out, if any.
 
   uint32_t i = 0;
   Flock_t  Flock[12];                                       // We aggregate timers that elapsed, to avoid frequent unlock/lock
@@ -125,6 +269,13 @@ static void advanceTmr(ftmrCtx_t ctx, uint32_t delta) {     // Advance the timeo
     delta -= ctx->timers->Time.rel;
     Flock[i].tmr = ctx->timers;
     ctx->timers = ctx->timers->next;                        // Unlink from the linked list
+    Flock[i].tmr->pprev = NULL;
+    if (ctx->timers) {
+      ctx->timers->pprev = & ctx->timers;
+    }
+    else {
+      ctx->Last.timer = NULL;                               // Don't let a callback insert after an unlinked timer.
+    }
     Flock[i].overshoot = delta; i++;
     if (i == NUM(Flock)) {                                  // Flock array full, empty it first
       ctx->advDelta = delta;                                // If the call inserts a timer, ensure it looks like the advance has completed fully
@@ -149,6 +300,8 @@ static void advanceTmr(ftmrCtx_t ctx, uint32_t delta) {     // Advance the timeo
 
   doFlock(ctx, Flock, i);                                   // Run what's left in the flock array, if any
 
+  return wakeup(ctx);                                       // After the callbacks, as they can insert timers.
+
 }
 
 static uint32_t noTmrLock(ftmrCtx_t ctx, uint32_t lock) {   // Dummy locker function, as default
@@ -156,12 +309,23 @@ static uint32_t noTmrLock(ftmrCtx_t ctx, uint32_t lock) {   // Dummy locker func
 }
 
 static FTmrCtx_t Mother = {
-  .timers   = NULL,
-  .advDelta = 0,
-  .advance  = advanceTmr,
-  .insert   = insertFTmr,
-  .remove   = removeFTmr,
-  .locker   = noTmrLock,
+  .timers     = NULL,
+  .advDelta   = 0,
+  .advance    = advanceTmr,
+  .insert     = insertFTmr,
+  .insertMany = insertMany,
+  .remove     = removeFTmr,
+  .locker     = noTmrLock,
+};
+
+static FTmrCtx_t LinkedMother = {
+  .timers     = NULL,
+  .advDelta   = 0,
+  .advance    = advanceTmr,
+  .insert     = insertFTmr,
+  .insertMany = insertMany,
+  .remove     = removeLinked,
+  .locker     = noTmrLock,
 };
 
 void initFTmrCtx(ftmrCtx_t ctx) {
@@ -169,3 +333,285 @@ void initFTmrCtx(ftmrCtx_t ctx) {
   memcpy(ctx, & Mother, sizeof(Mother));                    // To circumvent the const function pointer issue
 
 }
+
+void initFTmrCtxLinked(ftmrCtx_t ctx) {
+
+  memcpy(ctx, & LinkedMother, sizeof(LinkedMother));        // To circumvent the const function pointer issue
+
+}
+
+void initFTmr(ftmr_t tmr, tmrElapsed_t elapsed) {
+
+  tmr->next    = NULL;
+  tmr->pprev   = NULL;
+  tmr->elapsed = elapsed;
+  tmr->slack   = 0;
+
+}
+
+/*
+
+  Hierarchical timing wheel backend. A timer is kept in a slot list of the
+  level that matches the distance of its expiry to the current time; with
+  pprev pointing at the location that refers to it, both linking and
+  unlinking are O(1). The Time.abs field holds the absolute expiry, in units
+  since initialization, while the timer is in the wheel.
+
+  A level 0 slot only holds timers that expire at the very tick of that slot.
+  When the current time reaches a multiple of 64^L, the matching slot of
+  level L is cascaded, i.e. its timers are redistributed over lower levels.
+
+*/
+
+typedef struct FTmrWheel_t * wheel_t;
+
+#define SLOTS  (1u << FTMRBITS)
+#define MASK   (SLOTS - 1)
+#define SPAN   ((uint64_t) 1 << (FTMRBITS * FTMRLEVELS))   // Distance that fits in the wheel.
+
+static uint64_t rotr(uint64_t map, uint32_t n) {            // Rotate a slot map right over n bits.
+  return n ? (map >> n) | (map << (64 - n)) : map;
+}
+
+static void link(tmr_t * u, tmr_t tmr) {                    // Link a timer in at the head of the list at u.
+
+  tmr->next = *u;
+  if (tmr->next) {
+    tmr->next->pprev = & tmr->next;
+  }
+  *u = tmr;
+  tmr->pprev = u;
+
+}
+
+static void unlink(tmr_t tmr) {                             // Unlink a timer from whatever list it's in.
+
+  *tmr->pprev = tmr->next;
+  if (tmr->next) {
+    tmr->next->pprev = tmr->pprev;
+  }
+  tmr->pprev = NULL;
+
+}
+
+static void place(wheel_t w, tmr_t tmr) {                   // Link a timer in the slot that matches its expiry, not before w->now.
+
+  uint64_t e = tmr->Time.abs;
+  uint64_t d = e - w->now;
+  uint32_t l;
+  uint32_t s;
+
+  if (d >= SPAN) {                                          // Too far out; park it in the last level, it is placed again
+    e = w->now + SPAN - 1;                                  // when that slot cascades.
+    d = SPAN - 1;
+  }
+
+  for (l = 0; l < FTMRLEVELS - 1 && d >= (uint64_t) 1 << (FTMRBITS * (l + 1)); l++) { }
+
+  s = (uint32_t) (e >> (FTMRBITS * l)) & MASK;
+  link(& w->slot[l][s], tmr);
+  w->map[l] |= (uint64_t) 1 << s;
+
+}
+
+static void cascade(wheel_t w) {                            // Redistribute the higher level slots that w->now has reached.
+
+  uint32_t l;
+  uint32_t s;
+  tmr_t    list;
+
+  for (l = 1; l < FTMRLEVELS; l++) {
+    s = (uint32_t) (w->now >> (FTMRBITS * l)) & MASK;
+    list = w->slot[l][s];
+    w->slot[l][s] = NULL;
+    w->map[l] &= ~((uint64_t) 1 << s);
+    while (list) {
+      tmr_t tmr = list;
+      list = list->next;
+      place(w, tmr);                                        // Lands on a lower level, or in the same slot again, one lap later.
+    }
+    if (s) { break; }                                       // Higher levels only cascade when this one wraps.
+  }
+
+}
+
+static void add(ctx_t ctx, wheel_t w, tmr_t tmr) {          // Add a timer to the wheel; lock held.
+
+  uint64_t hi;
+
+  tmr->Time.abs += w->now + ctx->advDelta;                  // Absolute expiry; ctx->advDelta set during advanceWheel below.
+  if (tmr->slack && tmr->Time.abs > w->now) {               // Round up within the slack, clearing as many low bits as possible.
+    hi = tmr->Time.abs + tmr->slack;
+    hi &= ~(((uint64_t) 1 << (63 - __builtin_clzll((tmr->Time.abs - 1) ^ hi))) - 1);
+    tmr->slack -= (uint32_t) (hi - tmr->Time.abs);
+    tmr->Time.abs = hi;
+  }
+  if (tmr->Time.abs > w->now) {
+    place(w, tmr);
+  }
+  else {
+    link(& w->due, tmr);                                    // The slot of w->now has been done; elapse at the next advance.
+  }
+
+}
+
+static void insertWheel(ctx_t ctx, tmr_t tmr) {             // Insert a timer in the wheel; O(1).
+
+  ctx->locker(ctx, 1);                                      // Lock.
+
+  add(ctx, ctx->wheel, tmr);
+
+  ctx->locker(ctx, 0);                                      // Unlock.
+
+}
+
+static void insertManyWheel(ctx_t ctx, tmr_t tmrs[], uint32_t num) {  // No need to sort for the wheel.
+
+  uint32_t i;
+
+  ctx->locker(ctx, 1);                                      // Lock.
+
+  for (i = 0; i < num; i++) {
+    add(ctx, ctx->wheel, tmrs[i]);
+  }
+
+  ctx->locker(ctx, 0);                                      // Unlock.
+
+}
+
+static tmr_t removeWheel(ctx_t ctx, tmr_t tmr) {            // Remove a timer from the wheel; O(1).
+
+  wheel_t w = ctx->wheel;
+  tmr_t * first = & w->slot[0][0];
+  tmr_t   r = NULL;
+  size_t  s;
+
+  ctx->locker(ctx, 1);                                      // Lock.
+
+  if (tmr->pprev) {                                         // Not NULL means it's in the wheel.
+    if (! tmr->next && tmr->pprev >= first && tmr->pprev < first + FTMRLEVELS * SLOTS) {
+      s = (size_t) (tmr->pprev - first);                    // The only one in a slot; clear its map bit.
+      w->map[s / SLOTS] &= ~((uint64_t) 1 << (s % SLOTS));
+    }
+    unlink(tmr);
+    r = tmr;
+  }
+
+  ctx->locker(ctx, 0);                                      // Unlock.
+
+  return r;
+
+}
+
+static uint32_t advanceWheel(ftmrCtx_t ctx, uint32_t delta) {  // Advance the wheel, elapsing timers that timed out, if any.
+
+  wheel_t  w = ctx->wheel;
+  uint64_t target;
+  uint64_t next;
+  uint64_t step;
+  uint64_t bits;
+  uint32_t low;
+  uint32_t i = 0;
+  tmr_t *  u;
+  Flock_t  Flock[12];                                       // Same aggregation as for the list.
+
+  delta += ctx->locker(ctx, 1);                             // Lock
+
+  assert(0 == ctx->advDelta);
+
+  target = w->now + delta;
+  u = & w->due;                                             // First the expired ones, then slot by slot.
+
+  while (1) {
+    while (*u) {
+      Flock[i].tmr = *u;
+      Flock[i].overshoot = (uint32_t) (target - (*u)->Time.abs);
+      unlink(*u); i++;
+      if (i == NUM(Flock)) {                                // Flock array full, empty it first
+        ctx->advDelta = (uint32_t) (target - w->now);       // If the call inserts a timer, ensure it looks like the advance has completed fully
+        ctx->locker(ctx, 0);
+        doFlock(ctx, Flock, NUM(Flock)); i = 0;             // Run aggregated flock and reset
+        target += ctx->locker(ctx, 1);
+      }
+    }
+
+    if (u != & w->due) {
+      w->map[0] &= ~((uint64_t) 1 << (w->now & MASK));      // The slot is drained.
+    }
+
+    low = (uint32_t) w->now & MASK;                         // Find the next tick with a level 0 slot to elapse, or the next cascade.
+    bits = low == MASK ? 0 : w->map[0] >> (low + 1);
+    step = bits ? (uint64_t) __builtin_ctzll(bits) + 1 : SLOTS - low;
+    if (w->now + step > target) { break; }
+    w->now += step;
+    if (0 == (w->now & MASK)) {
+      cascade(w);
+    }
+    u = & w->slot[0][w->now & MASK];
+  }
+
+  w->now = target;
+
+  ctx->advDelta = 0;
+
+  ctx->locker(ctx, 0);                                      // Unlock
+
+  doFlock(ctx, Flock, i);                                   // Run what's left in the flock array, if any
+
+  next = ftmrWheelNext(ctx);                                // Slack was taken care of when inserting.
+
+  return next > FTMRIDLE ? FTMRIDLE : (uint32_t) next;
+
+}
+
+uint64_t ftmrWheelNext(ftmrCtx_t ctx) {
+
+  wheel_t  w = ctx->wheel;
+  uint64_t next = UINT64_MAX;
+  uint64_t at;
+  uint64_t cur;
+  uint64_t map;
+  uint32_t l;
+  uint32_t k;
+
+  ctx->locker(ctx, 1);                                      // Lock.
+
+  if (w->due) {
+    next = 0;
+  }
+  else {
+    for (l = 0; l < FTMRLEVELS; l++) {                      // The nearest non empty slot, in ticks, for each level.
+      cur = w->now >> (FTMRBITS * l);
+      map = rotr(w->map[l], (uint32_t) (cur + 1) & MASK);   // Bit 0 is now the slot after the current one.
+      if (map) {
+        k = (uint32_t) __builtin_ctzll(map) + 1;
+        at = (cur + k) << (FTMRBITS * l);                   // When it elapses (level 0) or cascades; no timer expires before.
+        if (at - w->now < next) { next = at - w->now; }
+      }
+    }
+  }
+
+  ctx->locker(ctx, 0);                                      // Unlock.
+
+  return next;
+
+}
+
+static FTmrCtx_t WheelMother = {
+  .timers     = NULL,
+  .advDelta   = 0,
+  .advance    = advanceWheel,
+  .insert     = insertWheel,
+  .insertMany = insertManyWheel,
+  .remove     = removeWheel,
+  .locker     = noTmrLock,
+};
+
+void initFTmrWheel(ftmrCtx_t ctx, ftmrWheel_t wheel) {
+
+  memcpy(ctx, & WheelMother, sizeof(WheelMother));          // To circumvent the const function pointer issue
+
+  memset(wheel, 0x00, sizeof(FTmrWheel_t));
+  ctx->wheel = wheel;
+
+}
@@ -7,23 +7,44 @@
 
 // Delta timer implementation
 
-typedef struct FTmrCtx_t * ftmrCtx_t;
-typedef struct FTmr_t *    ftmr_t;
+typedef struct FTmrCtx_t *   ftmrCtx_t;
+typedef struct FTmr_t *      ftmr_t;
+typedef struct FTmrWheel_t * ftmrWheel_t;
 
 typedef void (* tmrElapsed_t)(ftmrCtx_t ctx, ftmr_t tmr, uint32_t overshoot);
 
 typedef struct FTmr_t {
   ftmr_t       next;
+  ftmr_t *     pprev;             // (internal) location that refers to this timer, NULL when not inserted.
   tmrElapsed_t elapsed;           // Timeout callback; the second parameter is the overshoot number of timing units.
   union {
     uint64_t   rel;               // Against the previous in the list.
     uint64_t   abs;               // Absolute timeout; set this when calling FTmrCtx.insert.
   } Time;                         // Timing units, can be whatever you want it to be; see advance below.
+  uint32_t     slack;             // The timer may elapse up to this many units late; 0 for exact. Set before insert.
+  uint8_t      pad[4];
 } FTmr_t;
 
-typedef void     (* const tmrAdvance_t)(ftmrCtx_t ctx, uint32_t delta);
+/*
+
+  Slack lets timers share wakeups. On insert, the list puts a timer with
+  slack at the same expiry as the first timer that elapses within its
+  window, if any; the wheel rounds the expiry up within the window, to the
+  value with the most trailing zero bits, so that timers with slack tend to
+  land on the same ticks. Both lower the slack with the units used, so set
+  it again before every insert. The advance function returns the number of units
+  until the next wakeup is required: the earliest expiry plus slack of the
+  timers. Waking then elapses all the timers that are due by that time. It
+  returns FTMRIDLE when there are no timers.
+
+*/
+
+#define FTMRIDLE UINT32_MAX
+
+typedef uint32_t (* const tmrAdvance_t)(ftmrCtx_t ctx, uint32_t delta);
 typedef uint32_t (* tmrProtect_t)(ftmrCtx_t ctx, uint32_t lock);
 typedef void     (* const tmrInsert_t)(ftmrCtx_t ctx, ftmr_t tmr);
+typedef void     (* const tmrInsertMany_t)(ftmrCtx_t ctx, ftmr_t tmrs[], uint32_t num);
 typedef ftmr_t   (* const tmrRemove_t)(ftmrCtx_t ctx, ftmr_t tmr);
 
 typedef struct FTmrCtx_t {
@@ -32,13 +53,92 @@ typedef struct FTmrCtx_t {
     ftmr_t     timer;             // Last timer in the list, if any.
     uint64_t   abs;               // The absolute timeout of this timer.
   } Last;
-  tmrAdvance_t advance;           // To advance the list with the given number of timing units.
+  tmrAdvance_t advance;           // To advance the list with the given number of timing units; returns the units to the next wakeup.
   tmrInsert_t  insert;            // To insert a timer; can be called from timeout callback.
   tmrRemove_t  remove;            // To remove a timer before it elapses. Returns NULL when not found.
+  tmrInsertMany_t insertMany;     // To insert an array of timers at once, under a single lock; the array gets sorted.
   tmrProtect_t locker;            // Set to dummy by initFTmrCtx; can be overridden after call.
+  ftmrWheel_t  wheel;             // Wheel state when set up by initFTmrWheel, NULL for the list.
   uint32_t     advDelta;          // (internal) when (re)inserting during advance callback, add this to the timeout.
 } FTmrCtx_t;
 
 void initFTmrCtx(ftmrCtx_t ctx);  // Initialize a timer list context for fresh; set defaults.
 
+/*
+
+  The list keeps a back-link in each timer, to the location that refers to
+  it. A context initialized with initFTmrCtxLinked uses that to remove a
+  timer in O(1) instead of searching the list for it, which pays off when
+  most timers are cancelled before they elapse. The price is that a timer
+  must have pprev set to NULL before it is first inserted or removed, with
+  initFTmr or by zeroing it, as remove takes a non NULL pprev to mean the
+  timer is in the list. The wheel below makes the same assumption.
+
+*/
+
+void initFTmrCtxLinked(ftmrCtx_t ctx);                      // As initFTmrCtx, with an O(1) remove.
+void initFTmr(ftmr_t tmr, tmrElapsed_t elapsed);            // Set up a fresh timer with its callback.
+
+/*
+
+  Hierarchical timing wheel backend. The same insert, remove and advance
+  function pointers and the same semantics as the list, but insert and remove
+  are O(1), whatever the number of timers. Each level has 64 slots; a slot of
+  level L covers 64^L timing units. Timers further out than the span of the
+  wheel are parked in the last level and are re-evaluated when it cascades.
+
+  Advancing costs one step per non empty level 0 slot and one per 64 timing
+  units, so drive it with a sensible delta. The ctx->timers and ctx->Last
+  fields are not used by the wheel; to find out when the next timer is due,
+  call ftmrWheelNext().
+
+  The caller provides the wheel memory (about 2.6 KiB) and keeps it alive as
+  long as the context is used.
+
+*/
+
+#define FTMRBITS   6              // Slots per level is 1 << FTMRBITS; must be 6, 1 bit per slot in a uint64_t map.
+#define FTMRLEVELS 5              // Covers 2^30 timing units before parking.
+
+typedef struct FTmrWheel_t {
+  uint64_t     now;               // Timing units advanced since initialization.
+  uint64_t     map[FTMRLEVELS];   // Bit set for each non empty slot.
+  ftmr_t       due;               // Timers inserted with an expired timeout; elapse at the next advance.
+  ftmr_t       slot[FTMRLEVELS][1 << FTMRBITS];
+} FTmrWheel_t;
+
+void     initFTmrWheel(ftmrCtx_t ctx, ftmrWheel_t wheel);     // Initialize a context with the wheel backend; set defaults.
+uint64_t ftmrWheelNext(ftmrCtx_t ctx);                      // Units until the next advance is needed; never later than the first timer. UINT64_MAX when none.
+
+/*
+
+  Sharded timers, see delta-shards.c. One context per core, each owned by a
+  single thread, that advances it and runs its callbacks; its ticker. The
+  owner thread inserts and removes directly and without a lock. Other
+  threads arm a timer on a shard with ftmrShardArm, which pushes it, lock
+  free, on the inbox of the shard; the owner inserts the inbox timers right
+  after each advance, so their timeout counts from then on, never earlier.
+
+  Only the owner thread can remove timers of its shard. A timer that still
+  sits in the inbox is not found by remove.
+
+*/
+
+typedef struct FTmrShard_t * ftmrShard_t;
+
+typedef struct FTmrShard_t {
+  FTmrCtx_t    Ctx;               // Context of the shard; with a dummy locker, it's only used by the owner.
+  uint64_t     foreign;           // Number of timers that came in through the inbox.
+  uint8_t      pad[128 - sizeof(FTmrCtx_t) - sizeof(uint64_t)];
+  ftmr_t       inbox;             // Timers armed by other threads, last pushed first; on a cache line of its own.
+  uint8_t      pad2[64 - sizeof(ftmr_t)];
+} __attribute__((aligned(64))) FTmrShard_t;
+
+void        initFTmrShard(ftmrShard_t shard, ftmrWheel_t wheel);  // With a wheel backend if not NULL, else a linked list.
+void        ftmrShardBind(ftmrShard_t shard);               // Make the calling thread the owner of the shard.
+ftmrShard_t ftmrShardLocal(void);                           // Shard owned by the calling thread, or NULL.
+ftmrShard_t ftmrShardPick(FTmrShard_t shards[], uint32_t num);  // Own shard, else that of the current core.
+void        ftmrShardArm(ftmrShard_t shard, ftmr_t tmr);    // Arm a timer from any thread; Time.abs set.
+uint32_t    ftmrShardAdvance(ftmrShard_t shard, uint32_t delta);  // Owner only; advance, then take in the inbox. Returns as advance.
+
 #endif // DELTA_TIMERS_H
@@ -8,10 +8,13 @@
 #include <inttypes.h>
 
 #include <delta-timers.h>
+#include <tickless-ticker.h>
 
 void * ticker(void * mutref);     // Defined in pthread-ticker.c.
 
 static FTmrCtx_t Timers;          // Our timer context.
+static FTmrWheel_t Wheel;         // Wheel state, when running with -w.
+static FTick_t   Tick;            // Tickless driver, when running with -t.
 
 static pthread_mutex_t Mut;       // Mutex used for timer lock.
 
@@ -55,11 +58,11 @@ uint32_t tickisr(uint64_t now) {                            // This function is
 
   static uint64_t previous = 0;
 
-  Timers.advance(& Timers, (uint32_t)(now - previous));     // Advance the timers with delta units between now and previous call.
+  uint32_t to = Timers.advance(& Timers, (uint32_t)(now - previous));  // Advance the timers with delta units between now and previous call.
 
   previous = now;
 
-  uint32_t to = Timers.timers ? Timers.timers->Time.abs : 1;// Next timeout for the timer interrupt.
+  if (FTMRIDLE == to || ! to) { to = 1; }                   // Next timeout for the timer interrupt.
 
   // to = 1;
 
@@ -110,11 +113,33 @@ int main(int argc, char * argv[]) {
 
   pthread_mutex_init(& Mut, NULL);
 
-  initFTmrCtx(& Timers);
+  uint32_t wheel = 0;
+  uint32_t tickless = 0;
+
+  for (int i = 1; i < argc; i++) {
+    if (! strcmp(argv[i], "-w")) { wheel = 1; }             // Use the timing wheel backend instead of the list.
+    if (! strcmp(argv[i], "-t")) { tickless = 1; }          // Use the tickless driver instead of the pthread ticker.
+  }
+
+  if (wheel) {
+    initFTmrWheel(& Timers, & Wheel);
+  }
+  else {
+    initFTmrCtx(& Timers);
+  }
 
   Timers.locker = tmrlock;
 
-  pthread_create(& tickerthr, NULL, ticker, & Mut);
+  if (tickless) {
+    if (! initFTick(& Tick, & Timers, 1000000)) {           // Timing unit is 1 millisecond.
+      printf("Could not set up the tickless driver.\n");
+      exit(1);
+    }
+    pthread_create(& tickerthr, NULL, ftickRun, & Tick);
+  }
+  else {
+    pthread_create(& tickerthr, NULL, ticker, & Mut);
+  }
 
   while (1) {                                               // crtl-c to exit.
     done = 0;
@@ -133,8 +158,17 @@ int main(int argc, char * argv[]) {
         i--;
       }
     }
+    if (tickless) {
+      ftickRearm(& Tick);                                   // Inserted with Timers.insert, so all relative to the same advance.
+    }
     while (! done) { }                                      // Loop until all messages played.
     printf(" '%s'  overshot %u\n", buffer, overshot);
+    if (tickless) {
+      FTickStats_t Stats;
+      ftickStats(& Tick, & Stats);
+      printf("%"PRIu64" wakeups, jitter average %"PRIu64" ns, worst %"PRIu64" ns\n",
+        Stats.wakeups, Stats.wakeups ? Stats.sum / Stats.wakeups : 0, Stats.max);
+    }
     assert(! strcmp("The quick brown fox jumps over the lazy dog.", buffer));
   }
 
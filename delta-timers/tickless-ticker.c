@@ -0,0 +1,234 @@
+// Copyright 2023 Steven Buytaert
+
+#include <time.h>
+#include <string.h>
+#include <tickless-ticker.h>
+
+static const uint64_t nanos_per_sec = (1000ULL * 1000ULL * 1000ULL);
+
+static uint64_t monotonic(void) {                           // Return the current monotonic time in nanoseconds.
+
+  struct timespec Ts;
+
+  clock_gettime(CLOCK_MONOTONIC, & Ts);
+
+  return (uint64_t) Ts.tv_sec * nanos_per_sec + (uint64_t) Ts.tv_nsec;
+
+}
+
+#if defined(__linux__)
+
+#include <unistd.h>
+#include <sys/timerfd.h>
+
+static uint32_t setup(ftick_t tick) {
+
+  tick->fd = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC);
+
+  return tick->fd >= 0;
+
+}
+
+static void arm(ftick_t tick, uint64_t at) {                // Arm for the absolute time 'at', or disarm for UINT64_MAX; mutex held.
+
+  struct itimerspec Its;
+
+  memset(& Its, 0x00, sizeof(Its));                         // A zero it_value disarms; 'at' is never 0.
+
+  if (UINT64_MAX != at) {
+    Its.it_value.tv_sec  = (time_t) (at / nanos_per_sec);
+    Its.it_value.tv_nsec = (long) (at % nanos_per_sec);
+  }
+
+  (void) timerfd_settime(tick->fd, TFD_TIMER_ABSTIME, & Its, NULL);
+
+}
+
+static void snooze(ftick_t tick) {                          // Sleep until the armed time, which can move while we sleep.
+
+  uint64_t expirations;
+
+  (void) read(tick->fd, & expirations, sizeof(expirations));
+
+}
+
+static void teardown(ftick_t tick) {
+  close(tick->fd);
+}
+
+#else
+
+static uint32_t setup(ftick_t tick) {
+
+  pthread_condattr_t Attr;
+
+  tick->fd = -1;
+
+  pthread_condattr_init(& Attr);
+  pthread_condattr_setclock(& Attr, CLOCK_MONOTONIC);       // The deadlines are monotonic.
+
+  return 0 == pthread_cond_init(& tick->Cond, & Attr);
+
+}
+
+static void arm(ftick_t tick, uint64_t at) {                // The snoozing thread picks up the new deadline; mutex held.
+  (void) at;
+  pthread_cond_signal(& tick->Cond);
+}
+
+static void snooze(ftick_t tick) {
+
+  struct timespec Ts;
+
+  pthread_mutex_lock(& tick->Mut);
+  while (! __atomic_load_n(& tick->stop, __ATOMIC_RELAXED) && monotonic() < tick->deadline) {
+    if (UINT64_MAX == tick->deadline) {
+      pthread_cond_wait(& tick->Cond, & tick->Mut);
+    }
+    else {
+      Ts.tv_sec  = (time_t) (tick->deadline / nanos_per_sec);
+      Ts.tv_nsec = (long) (tick->deadline % nanos_per_sec);
+      pthread_cond_timedwait(& tick->Cond, & tick->Mut, & Ts);
+    }
+  }
+  pthread_mutex_unlock(& tick->Mut);
+
+}
+
+static void teardown(ftick_t tick) {
+  pthread_cond_destroy(& tick->Cond);
+}
+
+#endif // __linux__
+
+static void account(ftick_t tick, uint64_t jitter) {        // Add a wakeup to the statistics; mutex held.
+
+  uint64_t us = jitter / 1000u;
+  uint32_t b = us ? 64u - (uint32_t) __builtin_clzll(us) : 0;
+
+  tick->Stats.wakeups++;
+  tick->Stats.sum += jitter;
+  if (jitter > tick->Stats.max) { tick->Stats.max = jitter; }
+  tick->Stats.hist[b < 15 ? b : 15]++;
+
+}
+
+uint32_t initFTick(ftick_t tick, ftmrCtx_t ctx, uint64_t unit) {
+
+  memset(tick, 0x00, sizeof(FTick_t));
+
+  tick->ctx      = ctx;
+  tick->unit     = unit;
+  tick->base     = monotonic();
+  tick->deadline = UINT64_MAX;
+
+  pthread_mutex_init(& tick->Mut, NULL);
+
+  return setup(tick);
+
+}
+
+void * ftickRun(void * ref) {
+
+  ftick_t  tick = ref;
+  uint64_t now;
+  uint64_t at;
+  uint64_t base;
+  uint64_t units;
+  uint32_t next;
+  uint32_t due = 0;                                         // Non zero when the next advance is due already.
+
+  while (! __atomic_load_n(& tick->stop, __ATOMIC_RELAXED)) {
+
+    if (! due) {
+      snooze(tick);
+    }
+
+    if (__atomic_load_n(& tick->stop, __ATOMIC_RELAXED)) { break; }
+
+    now = monotonic();
+
+    pthread_mutex_lock(& tick->Mut);
+    if (UINT64_MAX != tick->deadline && now >= tick->deadline) {
+      account(tick, now - tick->deadline);
+    }
+    tick->deadline = UINT64_MAX;                            // Inserters arm against this while we advance.
+    pthread_mutex_unlock(& tick->Mut);
+
+    units = (now - tick->base) / tick->unit;                // Whole units only; the remainder counts for the next time.
+    if (units > UINT32_MAX) { units = UINT32_MAX; }
+    base = tick->base + units * tick->unit;
+
+    next = tick->ctx->advance(tick->ctx, (uint32_t) units);
+
+    __atomic_store_n(& tick->base, base, __ATOMIC_RELEASE);  // Only now; an inserter on the old base counts late, never early.
+
+    at = FTMRIDLE == next ? UINT64_MAX : base + (uint64_t) next * tick->unit;
+    due = at <= now;                                        // No point in sleeping; go again.
+
+    pthread_mutex_lock(& tick->Mut);
+    if (due) {
+      at = UINT64_MAX;
+    }
+    if (at < tick->deadline) {                              // Unless an inserter armed it earlier already.
+      tick->deadline = at;
+    }
+    arm(tick, tick->deadline);
+    pthread_mutex_unlock(& tick->Mut);
+
+  }
+
+  teardown(tick);
+
+  return NULL;
+
+}
+
+void ftickInsert(ftick_t tick, ftmr_t tmr) {
+
+  uint64_t base = __atomic_load_n(& tick->base, __ATOMIC_ACQUIRE);
+  uint64_t now = monotonic();
+  uint64_t at;
+
+  if (now > base) {                                         // Count from now; round up so it never elapses early.
+    tmr->Time.abs += (now - base + tick->unit - 1) / tick->unit;
+  }
+
+  at = base + (tmr->Time.abs + tmr->slack) * tick->unit;    // Before inserting, as that changes both.
+
+  tick->ctx->insert(tick->ctx, tmr);
+
+  pthread_mutex_lock(& tick->Mut);
+  if (at < tick->deadline) {                                // Due before the armed wakeup; re-arm.
+    tick->deadline = at;
+    arm(tick, at);
+  }
+  pthread_mutex_unlock(& tick->Mut);
+
+}
+
+void ftickRearm(ftick_t tick) {
+
+  pthread_mutex_lock(& tick->Mut);
+  tick->deadline = monotonic();                             // Due now; the ticker advances and arms for what's next.
+  arm(tick, tick->deadline);
+  pthread_mutex_unlock(& tick->Mut);
+
+}
+
+void ftickStop(ftick_t tick) {
+
+  pthread_mutex_lock(& tick->Mut);
+  __atomic_store_n(& tick->stop, 1, __ATOMIC_RELAXED);
+  arm(tick, 1);                                             // Wake it up at once.
+  pthread_mutex_unlock(& tick->Mut);
+
+}
+
+void ftickStats(ftick_t tick, FTickStats_t * stats) {
+
+  pthread_mutex_lock(& tick->Mut);
+  memcpy(stats, & tick->Stats, sizeof(FTickStats_t));
+  pthread_mutex_unlock(& tick->Mut);
+
+}
@@ -0,0 +1,58 @@
+#ifndef TICKLESS_TICKER_H
+#define TICKLESS_TICKER_H
+
+// Copyright 2023 Steven Buytaert
+
+#include <pthread.h>
+#include <delta-timers.h>
+
+/*
+
+  Tickless driver for a timer context. Instead of waking up at a fixed
+  period, the ticker thread sleeps on CLOCK_MONOTONIC until the absolute
+  time of the next wakeup that advance returned; on Linux with a timerfd,
+  elsewhere with a condition variable on the monotonic clock. Inserting a
+  timer through ftickInsert re-arms the sleep when the timer is due before
+  the current wakeup. Callbacks run on the ticker thread; they insert with
+  ctx->insert as usual, as advance takes those into account already.
+
+  ftickInsert counts the timeout of the timer from the moment of the call,
+  by adding the units that passed since the last advance, rounded up, so
+  that it never elapses early. Timers inserted with ctx->insert count from
+  the last advance instead, as with a ticking driver; call ftickRearm after
+  such inserts, so that the ticker picks them up.
+
+  For each wakeup, the jitter, i.e. how late the thread woke up compared to
+  the time it was armed for, is kept in the statistics.
+
+*/
+
+typedef struct FTickStats_t {
+  uint64_t        wakeups;        // Number of armed wakeups.
+  uint64_t        sum;            // Total jitter in nanoseconds, ...
+  uint64_t        max;            // ... and the worst.
+  uint64_t        hist[16];       // Wakeups per jitter; < 1 us, < 2 us, < 4 us, ..., the last one for the rest.
+} FTickStats_t;
+
+typedef struct FTick_t * ftick_t;
+
+typedef struct FTick_t {
+  ftmrCtx_t       ctx;            // The timer context it drives.
+  uint64_t        unit;           // Nanoseconds per timing unit.
+  uint64_t        base;           // Monotonic time in ns up to which ctx has been advanced.
+  uint64_t        deadline;       // Monotonic time in ns of the armed wakeup; UINT64_MAX when not armed.
+  pthread_mutex_t Mut;            // Guards deadline, the arming and the statistics.
+  pthread_cond_t  Cond;           // Used when there's no timerfd.
+  FTickStats_t    Stats;
+  int             fd;             // The timerfd, or -1.
+  uint32_t        stop;           // Set by ftickStop.
+} FTick_t;
+
+uint32_t initFTick(ftick_t tick, ftmrCtx_t ctx, uint64_t unit);  // Returns 0 on failure.
+void *   ftickRun(void * tick);                             // Body of the ticker thread; returns after ftickStop.
+void     ftickInsert(ftick_t tick, ftmr_t tmr);             // Insert from any thread but the ticker; Time.abs set.
+void     ftickRearm(ftick_t tick);                          // Wake up to re-evaluate, after inserting with ctx->insert directly.
+void     ftickStop(ftick_t tick);
+void     ftickStats(ftick_t tick, FTickStats_t * stats);    // Copy of the statistics so far.
+
+#endif // TICKLESS_TICKER_H
@@ -0,0 +1,742 @@
+// Copyright 2024 Steven Buytaert
+
+#define _GNU_SOURCE
+
+#include <umem.h>
+#include <umem-arenas.h>
+#include <stdio.h>
+#include <getopt.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <string.h>
+#include <assert.h>
+#include <pthread.h>
+#include <inttypes.h>
+#include <time.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+
+/*
+
+  Allocation benchmark; replays the same allocation trace against the different
+  allocation flavours of the micro memory manager and against the system malloc.
+
+  A trace is a sequence of operations for each thread; allocate a block for a
+  slot, reallocate the block of a slot or release the block of a slot. A
+  synthetic trace is generated from a seed, a size range, the mean number of
+  live blocks per thread, which sets the lifetime of the blocks, and the
+  percentage of reallocations. Sizes are spread evenly over the powers of 2
+  in the range, so small blocks are more frequent than large ones. At the end
+  of each thread trace, all remaining blocks are released.
+
+  A trace can be written to a file with -w and replayed later with -r; e.g. to
+  replay a trace recorded from a real application. The file holds a line for
+  each operation, in the sequence of execution for each thread:
+
+    <thread> a <slot> <size>          allocate size bytes for the slot.
+    <thread> r <slot> <size>          reallocate the block of the slot.
+    <thread> f <slot>                 release the block of the slot.
+
+  Each flavour is run in its own child process, so that the peak resident set
+  size can be reported for each flavour separately. The micro manager flavours
+  use a set of arenas, by default one per thread, in an mmap'ed space, so only
+  the pages that are used become resident. For each flavour, the throughput in
+  operations per second, over all threads, and the p50, p99 and p999 latency of
+  each kind of operation are shown; with -q, operations are not timed one by
+  one, which gives a better throughput figure. With -c, the micro manager
+  flavours coalesce lazily, with the given budget, and a coalescer thread
+  calls ucoalesce while the trace is being replayed.
+
+  With -B num, the trace is not replayed as such; for each allocation in it,
+  num blocks of its size are allocated as a burst, touched and then all
+  released again. The flavours do that one block at a time, except bulk,
+  which uses a single uar_malloc_bulk and uar_free_bulk for each burst. The
+  latencies are then those of a whole burst.
+
+  The flavours are
+    - umalloc:   umalloc/urealloc/ufree.
+    - fast:      umalloc_fast/urealloc/ufree_fast; when umalloc_fast fails, the
+                 home arena is cleaned and it is tried once more.
+    - aligned:   uamalloc on a 64 byte boundary/urealloc/ufree.
+    - magazine:  umag_malloc/urealloc/umag_free, with a magazine per thread.
+    - malloc:    the system malloc/realloc/free.
+    - bulk:      uar_malloc_bulk/uar_free_bulk; only with -B.
+
+*/
+
+typedef enum {
+  Op_Alloc        = 0,
+  Op_Realloc      = 1,
+  Op_Free         = 2,
+  Op_Num          = 3,
+} OpKind_t;
+
+typedef struct Op_t {             // A single trace operation.
+  uint32_t          slot;
+  uint32_t          size;         // Not used for Op_Free.
+  uint8_t           kind;
+  uint8_t           pad[3];
+} Op_t;
+
+#define SUBBITS    4              // Latency histogram; 16 buckets for each power of 2 nanoseconds.
+#define NUMBUCKETS (64 << SUBBITS)
+
+typedef struct Thr_t {            // Replaying thread context.
+  pthread_t         thread;
+  Op_t *            ops;
+  void **           slots;        // Block for each slot.
+  uint32_t          numops;
+  uint32_t          maxops;       // Capacity of ops.
+  uint32_t          numslots;
+  uint32_t          failed;       // Number of failed (re)allocations.
+  uint64_t          begin;        // Time the replay started and ...
+  uint64_t          end;          // ... ended, in nanoseconds.
+  uint64_t          blocks;       // Number of blocks allocated in bursts.
+  uint64_t          lat[Op_Num][NUMBUCKETS];
+#if defined(UMEMMAG)
+  UMag_t            Mag;
+#endif
+} Thr_t;
+
+typedef struct Flavour_t {
+  const char *      name;
+  void *          (*alloc)(Thr_t * thr, uint32_t size);
+  void *          (*realloc)(Thr_t * thr, void * mem, uint32_t size);
+  void            (*free)(Thr_t * thr, void * mem);
+  void            (*init)(Thr_t * thr);
+  uint32_t        (*allocn)(Thr_t * thr, uint32_t size, uint32_t num, void * mem[]);
+  void            (*freen)(Thr_t * thr, void * mem[], uint32_t num);
+} Flavour_t;
+
+static uarenas_t          arenas;
+static uint32_t           numthr = 1;
+static uint32_t           timed = 1;
+static Thr_t *            thrs;
+static pthread_barrier_t  Start;
+static uint32_t           budget;
+static uint32_t           burst;  // Number of blocks in a burst; 0 to replay the trace.
+static volatile uint32_t  replaying;
+
+#define NUM(A) (sizeof(A) / sizeof(A[0]))
+
+static void * uMalloc(Thr_t * thr, uint32_t size) { (void) thr; return uar_malloc(arenas, size, 0); }
+static void   uFree(Thr_t * thr, void * mem) { (void) thr; uar_free(arenas, mem); }
+
+#if defined(UREALLOC)
+static void * uRealloc(Thr_t * thr, void * mem, uint32_t size) { (void) thr; return uar_realloc(arenas, mem, size, 0); }
+#else
+static void * uRealloc(Thr_t * thr, void * mem, uint32_t size) { (void) thr; (void) mem; (void) size; return NULL; }
+#endif
+
+#if defined(UMEMFAST)
+static void * uFastMalloc(Thr_t * thr, uint32_t size) {
+
+  umemctx_t home;
+  void *    mem = uar_malloc_fast(arenas, size, 0);
+
+  (void) thr;
+
+  if (! mem) {                                              // Clean the home arena and retry once.
+    home = uar_home(arenas);
+    home->clean(home);
+    mem = uar_malloc_fast(arenas, size, 0);
+  }
+
+  return mem;
+
+}
+
+static void   uFastFree(Thr_t * thr, void * mem) { (void) thr; uar_free_fast(arenas, mem); }
+#endif
+
+#if defined(UAMALLOC)
+static void * uAlignedMalloc(Thr_t * thr, uint32_t size) { (void) thr; return uar_amalloc(arenas, size, 0, 64); }
+#endif
+
+#if defined(UMEMMAG)
+static void   uMagInit(Thr_t * thr) { initUMag(& thr->Mag, uar_home(arenas)); }
+
+static void * uMagMalloc(Thr_t * thr, uint32_t size) {
+
+  void * mem = umag_malloc(& thr->Mag, size, 0);
+
+  if (! mem) { mem = uar_malloc(arenas, size, 0); }         // Home arena exhausted; steal.
+
+  return mem;
+
+}
+
+static void   uMagFree(Thr_t * thr, void * mem) {
+
+  if (mem && uar_owner(arenas, mem) == thr->Mag.umem) {
+    umag_free(& thr->Mag, mem);
+  }
+  else {
+    uar_free_fast(arenas, mem);
+  }
+
+}
+#endif
+
+#if defined(UMEMFAST) && defined(UMEMBULK)
+static uint32_t uBulkMalloc(Thr_t * thr, uint32_t size, uint32_t num, void * mem[]) { (void) thr; return uar_malloc_bulk(arenas, size, num, mem, 0); }
+static void     uBulkFree(Thr_t * thr, void * mem[], uint32_t num) { (void) thr; uar_free_bulk(arenas, mem, num); }
+#endif
+
+static void * sMalloc(Thr_t * thr, uint32_t size) { (void) thr; return malloc(size); }
+static void * sRealloc(Thr_t * thr, void * mem, uint32_t size) { (void) thr; return realloc(mem, size); }
+static void   sFree(Thr_t * thr, void * mem) { (void) thr; free(mem); }
+
+static const Flavour_t Flavours[] = {
+  { "umalloc",  uMalloc,        uRealloc, uFree,     NULL,     NULL,        NULL      },
+#if defined(UMEMFAST)
+  { "fast",     uFastMalloc,    uRealloc, uFastFree, NULL,     NULL,        NULL      },
+#endif
+#if defined(UAMALLOC)
+  { "aligned",  uAlignedMalloc, uRealloc, uFree,     NULL,     NULL,        NULL      },
+#endif
+#if defined(UMEMMAG)
+  { "magazine", uMagMalloc,     uRealloc, uMagFree,  uMagInit, NULL,        NULL      },
+#endif
+  { "malloc",   sMalloc,        sRealloc, sFree,     NULL,     NULL,        NULL      },
+#if defined(UMEMFAST) && defined(UMEMBULK)
+  { "bulk",     uFastMalloc,    uRealloc, uFastFree, NULL,     uBulkMalloc, uBulkFree },
+#endif
+};
+
+static uint32_t ns2bucket(uint64_t ns) {                    // Keep the SUBBITS most significant bits.
+
+  uint32_t log2;
+
+  if (ns < (1u << SUBBITS)) { return (uint32_t) ns; }
+
+  log2 = (uint32_t) (63 - __builtin_clzll(ns));
+
+  return ((log2 - SUBBITS + 1) << SUBBITS) | (uint32_t) ((ns >> (log2 - SUBBITS)) & ((1u << SUBBITS) - 1));
+
+}
+
+static uint64_t bucket2ns(uint32_t bucket) {                // Return the lower bound of the bucket.
+
+  uint32_t log2 = (bucket >> SUBBITS) + SUBBITS - 1;
+
+  if (bucket < (1u << SUBBITS)) { return bucket; }
+
+  return (uint64_t) ((1u << SUBBITS) | (bucket & ((1u << SUBBITS) - 1))) << (log2 - SUBBITS);
+
+}
+
+static uint64_t now(void) {                                 // Monotonic time in nanoseconds.
+
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, & ts);
+
+  return (uint64_t) ts.tv_sec * 1000000000ull + (uint64_t) ts.tv_nsec;
+
+}
+
+static uint64_t rss(void) {                                 // Current resident set size in KiB.
+
+  FILE *        f = fopen("/proc/self/statm", "r");
+  unsigned long pages = 0;
+
+  if (f) {
+    if (1 != fscanf(f, "%*u %lu", & pages)) { pages = 0; }
+    fclose(f);
+  }
+
+  return pages * (uint64_t) sysconf(_SC_PAGESIZE) / 1024;
+
+}
+
+static uint32_t xorshift(uint32_t * state) {                // Small reproducible random generator.
+
+  uint32_t x = *state;
+
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+
+  return *state = x;
+
+}
+
+static void add(Thr_t * thr, OpKind_t kind, uint32_t slot, uint32_t size) {
+
+  if (thr->numops == thr->maxops) {
+    thr->maxops = thr->maxops ? 2 * thr->maxops : 1024;
+    thr->ops = realloc(thr->ops, thr->maxops * sizeof(Op_t));
+    assert(thr->ops);
+  }
+
+  thr->ops[thr->numops++] = (Op_t) { .slot = slot, .size = size, .kind = (uint8_t) kind };
+  if (slot >= thr->numslots) { thr->numslots = slot + 1; }
+
+}
+
+static uint32_t randsize(uint32_t * seed, uint32_t min, uint32_t max) {  // Evenly over the powers of 2.
+
+  uint32_t lo = 31 - (uint32_t) __builtin_clz(min);
+  uint32_t hi = 31 - (uint32_t) __builtin_clz(max);
+  uint32_t e = lo + xorshift(seed) % (hi - lo + 1);
+  uint32_t size = (1u << e) + xorshift(seed) % (1u << e);
+
+  return size < min ? min : size > max ? max : size;
+
+}
+
+static void synthesize(Thr_t * thr, uint32_t seed, uint32_t numops, uint32_t min, uint32_t max, uint32_t live, uint32_t reallocs) {
+
+  uint32_t * used = malloc(numops * sizeof(uint32_t));      // Slots in use.
+  uint32_t * vacant = malloc(numops * sizeof(uint32_t));    // Slots released again, for reuse.
+  uint32_t   numused = 0;
+  uint32_t   numvacant = 0;
+  uint32_t   slot;
+  uint32_t   i;
+  uint32_t   r;
+
+  assert(used && vacant);
+
+  for (i = 0; i < numops; i++) {
+    r = xorshift(& seed) % (numused + live);
+    if (r < numused && xorshift(& seed) % 100 < reallocs) { // Reallocate a live block.
+      add(thr, Op_Realloc, used[r], randsize(& seed, min, max));
+    }
+    else if (r < numused) {                                 // Release a live block; chance grows with live count.
+      slot = used[r];
+      used[r] = used[--numused];
+      vacant[numvacant++] = slot;
+      add(thr, Op_Free, slot, 0);
+    }
+    else {                                                  // Allocate a new block.
+      slot = numvacant ? vacant[--numvacant] : numused + numvacant;
+      used[numused++] = slot;
+      add(thr, Op_Alloc, slot, randsize(& seed, min, max));
+    }
+  }
+
+  while (numused) {                                         // Release all that remain.
+    add(thr, Op_Free, used[--numused], 0);
+  }
+
+  free(used);
+  free(vacant);
+
+}
+
+static uint32_t load(const char * name) {                   // Load a recorded trace; return number of threads.
+
+  FILE *   f = fopen(name, "r");
+  uint32_t t;
+  uint32_t slot;
+  uint32_t size;
+  char     kind;
+  int      n;
+
+  if (! f) { return 0; }
+
+  numthr = 0;
+  while (3 <= (n = fscanf(f, "%u %c %u", & t, & kind, & slot))) {
+    size = 0;
+    if ('f' != kind && 1 != fscanf(f, "%u", & size)) { break; }
+    if (t >= 1024) { break; }                               // Apply some limit.
+    if (t >= numthr) {
+      thrs = realloc(thrs, (t + 1) * sizeof(Thr_t));
+      assert(thrs);
+      memset(& thrs[numthr], 0x00, (t + 1 - numthr) * sizeof(Thr_t));
+      numthr = t + 1;
+    }
+    add(& thrs[t], 'a' == kind ? Op_Alloc : 'r' == kind ? Op_Realloc : Op_Free, slot, size);
+  }
+
+  fclose(f);
+
+  return numthr;
+
+}
+
+static void save(const char * name) {
+
+  FILE *   f = fopen(name, "w");
+  Op_t *   op;
+  uint32_t t;
+  uint32_t i;
+
+  assert(f);
+
+  for (t = 0; t < numthr; t++) {
+    for (i = 0, op = thrs[t].ops; i < thrs[t].numops; i++, op++) {
+      if (Op_Free == op->kind) {
+        fprintf(f, "%u f %u\n", t, op->slot);
+      }
+      else {
+        fprintf(f, "%u %c %u %u\n", t, Op_Alloc == op->kind ? 'a' : 'r', op->slot, op->size);
+      }
+    }
+  }
+
+  fclose(f);
+
+}
+
+static const Flavour_t * flavour;
+
+static void bursts(Thr_t * thr) {                           // For each allocation in the trace, a burst of blocks of its size.
+
+  Op_t *   op = thr->ops;
+  void **  mem = thr->slots;
+  uint64_t t0 = 0;
+  uint32_t got;
+  uint32_t i;
+  uint32_t j;
+
+  for (i = 0; i < thr->numops; i++, op++) {
+    if (Op_Alloc != op->kind) { continue; }
+    if (timed) { t0 = now(); }
+    if (flavour->allocn) {
+      got = flavour->allocn(thr, op->size, burst, mem);
+    }
+    else {
+      for (got = 0; got < burst && NULL != (mem[got] = flavour->alloc(thr, op->size)); got++) { }
+    }
+    if (timed) { thr->lat[Op_Alloc][ns2bucket(now() - t0)]++; }
+
+    for (j = 0; j < got; j++) {
+      memset(mem[j], 0x5a, op->size);                       // Touch it, as an application would.
+    }
+    thr->failed += burst - got;
+    thr->blocks += got;
+
+    if (timed) { t0 = now(); }
+    if (flavour->freen) {
+      flavour->freen(thr, mem, got);
+    }
+    else {
+      for (j = 0; j < got; j++) { flavour->free(thr, mem[j]); }
+    }
+    if (timed) { thr->lat[Op_Free][ns2bucket(now() - t0)]++; }
+  }
+
+}
+
+static void * replay(void * arg) {
+
+  Thr_t *    thr = arg;
+  Op_t *     op = thr->ops;
+  void **    slot;
+  void *     mem;
+  uint64_t   t0 = 0;
+  uint32_t   i;
+
+  if (flavour->init) { flavour->init(thr); }
+
+  pthread_barrier_wait(& Start);
+
+  thr->begin = now();
+
+  if (burst) {
+    bursts(thr);
+  }
+
+  for (i = 0; ! burst && i < thr->numops; i++, op++) {
+    slot = & thr->slots[op->slot];
+    if (timed) { t0 = now(); }
+    switch (op->kind) {
+      case Op_Alloc: {
+        mem = flavour->alloc(thr, op->size);
+        break;
+      }
+
+      case Op_Realloc: {
+        mem = flavour->realloc(thr, *slot, op->size);
+        break;
+      }
+
+      default: {
+        flavour->free(thr, *slot);
+        mem = NULL;
+        break;
+      }
+    }
+    if (timed) { thr->lat[op->kind][ns2bucket(now() - t0)]++; }
+
+    if (mem) {
+      memset(mem, 0x5a, op->size);                          // Touch it, as an application would.
+      *slot = mem;
+    }
+    else if (Op_Free == op->kind) {
+      *slot = NULL;
+    }
+    else {                                                  // Allocation failed; a failed realloc keeps its block.
+      thr->failed++;
+    }
+  }
+
+  thr->end = now();
+
+#if defined(UMEMMAG)
+  if (flavour->init) { umag_drain(& thr->Mag); }
+#endif
+
+  return NULL;
+
+}
+
+static void * coalesce(void * arg) {                        // Coalescer thread; see ucoalesce.
+
+  uint32_t busy;
+  uint32_t i;
+
+  (void) arg;
+
+  while (replaying) {
+    for (busy = 0, i = 0; i < arenas->num; i++) {
+      busy |= ucoalesce(& arenas->Arena[i], budget);
+    }
+    if (! busy) { usleep(50); }
+  }
+
+  return NULL;
+
+}
+
+static void percentiles(const char * kind, uint64_t lat[NUMBUCKETS]) {
+
+  static const uint32_t Permille[] = { 500, 990, 999 };
+
+  uint64_t total = 0;
+  uint64_t count = 0;
+  uint32_t p = 0;
+  uint32_t b;
+
+  for (b = 0; b < NUMBUCKETS; b++) { total += lat[b]; }
+
+  printf("  %-8s %10"PRIu64" ops", kind, total);
+  for (b = 0; total && b < NUMBUCKETS && p < NUM(Permille); b++) {
+    count += lat[b];
+    while (p < NUM(Permille) && count * 1000 >= total * Permille[p]) {
+      printf(", p%u %6"PRIu64" ns", Permille[p] == 500 ? 50 : Permille[p] == 990 ? 99 : 999, bucket2ns(b));
+      p++;
+    }
+  }
+  printf("\n");
+
+}
+
+static void run(const Flavour_t * f, uint32_t spacesz, uint32_t numarenas) {
+
+  static const char * Kinds[] = { "alloc", "realloc", "free" };
+
+  uint8_t *  space = NULL;
+  uint64_t   before = rss();
+  uint64_t   total = 0;
+  uint64_t   t0;
+  uint64_t   t1;
+  uint32_t   failed = 0;
+  uint32_t   chunks = 0;
+  uint32_t   t;
+  uint32_t   k;
+  pthread_t  coalescer;
+  struct rusage Usage;
+
+  flavour = f;
+
+  if (f->alloc != sMalloc) {
+    space = mmap(NULL, spacesz, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    assert(space != MAP_FAILED);
+    arenas = malloc(uarenassize(numarenas));
+    assert(arenas);
+    if (! initUArenas(arenas, numarenas, space, spacesz)) {
+      printf("%-10s: can not divide %u bytes over %u arenas.\n", f->name, spacesz, numarenas);
+      return;
+    }
+    for (t = 0; budget && t < numarenas; t++) {
+      arenas->Arena[t].budget = budget;
+    }
+  }
+
+  replaying = 1;
+  if (space && budget) {
+    pthread_create(& coalescer, NULL, coalesce, NULL);
+  }
+
+  pthread_barrier_init(& Start, NULL, numthr + 1);
+  for (t = 0; t < numthr; t++) {
+    memset(thrs[t].lat, 0x00, sizeof(thrs[t].lat));
+    thrs[t].slots = calloc((thrs[t].numslots > burst ? thrs[t].numslots : burst) + 1, sizeof(void *));
+    assert(thrs[t].slots);
+    pthread_create(& thrs[t].thread, NULL, replay, & thrs[t]);
+  }
+
+  pthread_barrier_wait(& Start);
+  for (t = 0; t < numthr; t++) {
+    pthread_join(thrs[t].thread, NULL);
+  }
+
+  replaying = 0;
+  if (space && budget) {
+    pthread_join(coalescer, NULL);
+  }
+
+  t0 = thrs[0].begin;
+  t1 = thrs[0].end;
+  for (t = 0; t < numthr; t++) {                            // Merge latencies into those of thread 0.
+    t0 = thrs[t].begin < t0 ? thrs[t].begin : t0;
+    t1 = thrs[t].end > t1 ? thrs[t].end : t1;
+    total += burst ? 2 * thrs[t].blocks : thrs[t].numops;   // A block in a burst is allocated and released.
+    failed += thrs[t].failed;
+    for (k = 0; t && k < Op_Num; k++) {
+      for (uint32_t b = 0; b < NUMBUCKETS; b++) { thrs[0].lat[k][b] += thrs[t].lat[k][b]; }
+    }
+  }
+
+  if (space) {
+    for (t = 0; t < numarenas; t++) {
+      arenas->Arena[t].clean(& arenas->Arena[t]);
+      chunks += arenas->Arena[t].numchunks;
+    }
+  }
+
+  getrusage(RUSAGE_SELF, & Usage);
+
+  printf("%-10s: %u thread%s, ", f->name, numthr, numthr == 1 ? "" : "s");
+  if (burst) { printf("bursts of %u blocks, ", burst); }
+  printf("%.0f ops/sec, %u failed, peak RSS %ld KiB (%"PRIu64" KiB at start)",
+    (double) total * 1e9 / (double) (t1 - t0), failed,
+    Usage.ru_maxrss, before);
+  if (space) { printf(", %u chunk%s left in %u arena%s", chunks, chunks == 1 ? "" : "s", numarenas, numarenas == 1 ? "" : "s"); }
+  printf(".\n");
+
+  for (k = 0; timed && k < Op_Num; k++) {
+    if (burst && Op_Realloc == k) { continue; }             // Bursts don't reallocate.
+    percentiles(Kinds[k], thrs[0].lat[k]);
+  }
+
+}
+
+static const struct option Options[] = {
+  { "numthreads", 1, NULL, 'n' },
+  { "ops",        1, NULL, 'o' },
+  { "min",        1, NULL, 'l' },
+  { "max",        1, NULL, 'u' },
+  { "live",       1, NULL, 'L' },
+  { "reallocs",   1, NULL, 'R' },
+  { "seed",       1, NULL, 'S' },
+  { "space",      1, NULL, 's' },
+  { "arenas",     1, NULL, 'a' },
+  { "flavour",    1, NULL, 'f' },
+  { "read",       1, NULL, 'r' },
+  { "write",      1, NULL, 'w' },
+  { "quick",      0, NULL, 'q' },
+  { "coalesce",   1, NULL, 'c' },
+  { "burst",      1, NULL, 'B' },
+  { "help",       0, NULL, 'h' },
+  { NULL,         0, NULL,  0  },
+};
+
+int main(int argc, char * argv[]) {
+
+  uint32_t     numops = 1000000;
+  uint32_t     min = 16;
+  uint32_t     max = 1024;
+  uint32_t     live = 1000;
+  uint32_t     reallocs = 10;
+  uint32_t     seed = 0x2024;
+  uint32_t     spacesz = 0;
+  uint32_t     numarenas = 0;
+  uint64_t     slice;
+  const char * only = NULL;
+  const char * input = NULL;
+  const char * output = NULL;
+  int32_t      o;
+  int32_t      ai;                                          // Argument index.
+  uint32_t     i;
+  pid_t        pid;
+
+  do {
+    o = getopt_long(argc, argv, "hn:o:l:u:L:R:S:s:a:f:r:w:qc:B:", Options, & ai);
+    switch (o) {
+      case 'n': numthr = (uint32_t) atoi(optarg); numthr = numthr ? numthr : 1; break;
+      case 'o': numops = (uint32_t) atoi(optarg); break;
+      case 'l': min = (uint32_t) atoi(optarg); min = min ? min : 1; break;
+      case 'u': max = (uint32_t) atoi(optarg); break;
+      case 'L': live = (uint32_t) atoi(optarg); live = live ? live : 1; break;
+      case 'R': reallocs = (uint32_t) atoi(optarg); break;
+      case 'S': seed = (uint32_t) atoi(optarg); seed = seed ? seed : 1; break;
+      case 's': spacesz = (uint32_t) atoi(optarg); break;
+      case 'a': numarenas = (uint32_t) atoi(optarg); break;
+      case 'f': only = optarg; break;
+      case 'r': input = optarg; break;
+      case 'w': output = optarg; break;
+      case 'q': timed = 0; break;
+      case 'c': budget = (uint32_t) atoi(optarg); break;
+      case 'B': burst = (uint32_t) atoi(optarg); break;
+
+      case 'h': case '?': {
+        printf("%s [options]\n", argv[0]);
+        printf("--numthreads -n : number of threads in a synthetic trace; default %u.\n", numthr);
+        printf("--ops        -o : number of operations per thread in a synthetic trace; default %u.\n", numops);
+        printf("--min        -l : minimum block size; default %u bytes.\n", min);
+        printf("--max        -u : maximum block size; default %u bytes.\n", max);
+        printf("--live       -L : mean number of live blocks per thread; default %u.\n", live);
+        printf("--reallocs   -R : percentage of operations on live blocks that reallocate; default %u.\n", reallocs);
+        printf("--seed       -S : seed for the synthetic trace; default %u.\n", seed);
+        printf("--space      -s : space for the micro manager; default 2 MByte - 1 for each arena.\n");
+        printf("--arenas     -a : number of arenas; default one per thread.\n");
+        printf("--flavour    -f : only run the given flavour; umalloc, fast, aligned, magazine, malloc or bulk.\n");
+        printf("--read       -r : replay the trace from the given file.\n");
+        printf("--write      -w : write the trace to the given file.\n");
+        printf("--quick      -q : do not time each operation; gives a better ops/sec figure.\n");
+        printf("--coalesce   -c : coalesce lazily with the given budget, in a coalescer thread.\n");
+        printf("--burst      -B : allocate and release bursts of the given number of blocks, instead of replaying the trace.\n");
+        return 1;
+        break;
+      }
+    }
+  } while (o != -1);                                        // Process as long as there are options.
+
+  if (input) {
+    if (! load(input)) {
+      printf("Could not load any trace from '%s'.\n", input);
+      return 1;
+    }
+  }
+  else {
+    if (max < min) { max = min; }
+    thrs = calloc(numthr, sizeof(Thr_t));
+    assert(thrs);
+    for (i = 0; i < numthr; i++) {
+      synthesize(& thrs[i], seed + i, numops, min, max, live, reallocs);
+    }
+  }
+
+  if (output) { save(output); }
+
+  numarenas = numarenas ? numarenas : numthr;
+  slice = UMEMMAXSPAN;                                      // Limit to what we can represent in each arena ...
+  if (slice > 0x7fffffffu / numarenas) {                    // ... and to 2 GByte in total.
+    slice = 0x7fffffffu / numarenas;
+  }
+  if (! spacesz || spacesz / numarenas > slice) {
+    spacesz = numarenas * (uint32_t) slice;
+  }
+
+  for (i = 0; i < NUM(Flavours); i++) {
+    if (only && strcmp(only, Flavours[i].name)) { continue; }
+    if (! burst && Flavours[i].allocn) { continue; }        // Only does bursts.
+    fflush(stdout);
+    pid = fork();                                           // Run each flavour in a fresh process.
+    assert(pid >= 0);
+    if (0 == pid) {
+      run(& Flavours[i], spacesz, numarenas);
+      fflush(stdout);
+      _exit(0);
+    }
+    waitpid(pid, NULL, 0);
+  }
+
+  return 0;
+
+}
@@ -1,6 +1,7 @@
 // Copyright 2024 Steven Buytaert
 
 #include <umem.h>
+#include <umem-arenas.h>
 #include <stdio.h>
 #include <getopt.h>
 #include <stdlib.h>
@@ -21,9 +22,19 @@
   The process of allocation/release for each thread runs forever until control-c
   is pressed.
 
+  The memory can be divided over a number of arenas (see umem-arenas.h); each
+  mutator thread then uses its own home arena first. Each mutator thread can
+  also use a magazine, in front of its home arena, for the faster allocation
+  and release. With a coalescing budget, the arenas coalesce lazily and a
+  coalescer thread releases the waiting chunks, budget chunks at a time.
+
+  Before the mutator threads start, the bulk allocation and release and the
+  in place reallocation are checked on the fresh arenas; see checkBulk and
+  checkInplace.
+
   The monitor thread, will dump some statistics, each second;
-    - the number of current chunks in the micro manager
-    - the contention rate per second (see the contention callback).
+    - the number of current chunks in the micro manager, over all arenas.
+    - the contention rate per second (see the contention callback), over all arenas.
     - running time
     - for each thread, the number of operations done and the number of bytes
       currently allocated and that mutator thread.
@@ -40,16 +51,20 @@ typedef struct Block_t {
 } Block_t;
 
 typedef struct Mut_t {            // Mutator Thread Context.
-  umemctx_t         umem;         // Micro Memory to use.
+  uarenas_t         arenas;       // Micro Memory arenas to use.
   pthread_t         thread;
   Block_t           blocks[512];  // Collection of blocks.
+#if defined(UMEMMAG)
+  UMag_t            Mag;          // Magazine in front of the home arena.
+#endif
   uint64_t          ops;          // Total operation count.
   uint32_t          inuse;        // Number of bytes in use.
   uint32_t          filled;       // Number of slots filled in blocks.
   volatile uint16_t run;
   uint8_t           tid;          // Simple thread id; starts at 0.
   volatile uint8_t  releaseonly;  // When non zero, only fast release allowed.
-  char              name[36];
+  uint8_t           usemag;       // When non zero, use the magazine.
+  char              name[35];
 } Mut_t;
 
 #define NUM(A) (sizeof(A) / sizeof(A[0]))
@@ -73,13 +88,20 @@ static void * mutate(void * arg) {
   uint32_t  what;
   uint32_t  size;
   uint32_t  s;
-  umemctx_t umem = mut->umem;
+  uarenas_t arenas = mut->arenas;
   Block_t * b;
   void *    mem;
 
+#if defined(UMEMMAG)
+  initUMag(& mut->Mag, uar_home(arenas));
+#endif
+
   while (mut->run) {
     what = rand() & 0b111;                                  // Randomly select an operation.
     if (mut->releaseonly) { what = 4; }                     // 4 is slower coalescing release.
+#if defined(UMEMMAG)
+    if (mut->releaseonly) { umag_drain(& mut->Mag); }       // Magazine blocks are still in use.
+#endif
 
     switch (what) {
       case 0: case 1: case 2: case 3: {                     // Allocate; most prefered command.
@@ -91,17 +113,22 @@ static void * mutate(void * arg) {
           b = & mut->blocks[s];
           b->mem = NULL;                                    // Preset in case UMEMFAST/UAMALLOC not defined.
           if (0 == what) {
-            b->mem = umalloc(umem, size, mut->tid);         // Slow.
+            b->mem = uar_malloc(arenas, size, mut->tid);    // Slow.
+          }
+#if defined(UMEMMAG)
+          else if (mut->usemag && (1 == what || 2 == what)) {
+            b->mem = umag_malloc(& mut->Mag, size, mut->tid); // Fastest.
           }
+#endif
 #if defined(UMEMFAST)
           else if (1 == what || 2 == what) {
-            b->mem = umalloc_fast(umem, size, mut->tid);    // Faster.
+            b->mem = uar_malloc_fast(arenas, size, mut->tid); // Faster.
           }
 #endif
 #if defined(UAMALLOC)
           else {
             uint32_t ma = (1u << (2 + (rand() & 0b111)));   // Get some alignment between 4 and 256.
-            b->mem = uamalloc(umem, size, mut->tid, ma);
+            b->mem = uar_amalloc(arenas, size, mut->tid, ma);
             assert(! ((uintptr_t) b->mem & (ma - 1)));      // Check aligment; b->mem can be NULL.
           }
 #endif
@@ -127,13 +154,18 @@ static void * mutate(void * arg) {
           assert(blockOK(b, mut->tid));
 #if defined(UMEMFAST)
           if (4 == what) {
-            ufree(umem, b->mem);                            // Slow release.
+            uar_free(arenas, b->mem);                       // Slow release.
+          }
+#if defined(UMEMMAG)
+          else if (mut->usemag && uar_owner(arenas, b->mem) == mut->Mag.umem) {
+            umag_free(& mut->Mag, b->mem);                  // Fastest release.
           }
+#endif
           else {
-            ufree_fast(umem, b->mem);                       // Faster release.
+            uar_free_fast(arenas, b->mem);                  // Faster release.
           }
 #else
-          ufree(umem, b->mem);                              // Only slow release.
+          uar_free(arenas, b->mem);                         // Only slow release.
 #endif
           mut->filled--;                                    // Update slot and count.
           b->mem = NULL;
@@ -152,7 +184,7 @@ static void * mutate(void * arg) {
           b = & mut->blocks[s];
           assert(blockOK(b, mut->tid));
           size = 1 + (uint32_t) (rand() % 256);             // Select a new size.
-          mem = urealloc(umem, b->mem, size, 0x00);         // Tags of current block will be used.
+          mem = uar_realloc(arenas, b->mem, size, 0x00);    // Tags of current block will be used.
           if (mem) {                                        // Realloc worked.
             mut->ops++;
             mut->inuse += (size - b->size);                 // Update number of bytes in use up or down.
@@ -179,9 +211,143 @@ static void contCb(umemctx_t umem) {                        // Contention callba
   usleep(2000 * (1 + ((uint32_t) rand() % 0x0f)));          // Do some random backoff.
 }
 
+static void * coalesce(void * arg) {                        // Coalescer thread; see ucoalesce.
+
+  uarenas_t arenas = arg;
+  uint32_t  busy;
+  uint32_t  i;
+
+  while (1) {
+    for (busy = 0, i = 0; i < arenas->num; i++) {
+      busy |= ucoalesce(& arenas->Arena[i], arenas->Arena[i].budget);
+    }
+    if (! busy) { usleep(100); }                            // Nothing left to do; idle a bit.
+  }
+
+  return NULL;
+
+}
+
+static uint32_t numChunks(uarenas_t arenas) {              // Coalesce all arenas, then count their chunks.
+
+  uint32_t chunks = 0;
+
+  for (uint32_t i = 0; i < arenas->num; i++) {
+    while (ucoalesce(& arenas->Arena[i], UINT32_MAX)) {     // Also waits for the coalescer thread.
+      usleep(1000);
+    }
+    chunks += arenas->Arena[i].numchunks;
+  }
+
+  return chunks;
+
+}
+
+#if defined(UMEMFAST) && defined(UMEMBULK)
+
+static int cmpmem(const void * a, const void * b) {
+  uintptr_t x = (uintptr_t) *(void * const *) a;
+  uintptr_t y = (uintptr_t) *(void * const *) b;
+  return (x > y) - (x < y);
+}
+
+static void checkBulk(uarenas_t arenas, uint32_t spacesz, uint32_t size, uint32_t num) {
+
+  void **   mem = malloc(num * sizeof(void *));
+  void **   sorted = malloc(num * sizeof(void *));
+  uint8_t * c;
+  uint32_t  got;
+  uint32_t  i;
+
+  assert(mem && sorted);
+
+  got = uar_malloc_bulk(arenas, size, num, mem, 0xbb);
+  assert(got == num || got < spacesz / size);               // All of them, or out of memory.
+  for (i = 0; i < got; i++) {
+    assert(alignedok(mem[i]));
+    assert(mem2chunk(mem[i])->tags == 0xbb);
+    memset(mem[i], (uint8_t) i, size);
+  }
+
+  memcpy(sorted, mem, got * sizeof(void *));
+  qsort(sorted, got, sizeof(void *), cmpmem);
+  for (i = 1; i < got; i++) {                               // No two blocks overlap.
+    assert((uint8_t *) sorted[i - 1] + size <= (uint8_t *) sorted[i]);
+  }
+
+  for (i = 0; i < got; i++) {                               // And no block was overwritten by another one.
+    c = mem[i];
+    assert(c[0] == (uint8_t) i && c[size - 1] == (uint8_t) i);
+  }
+
+  if (got > 1) {                                            // A released slot is skipped by ufree_bulk.
+    uar_free(arenas, mem[got / 2]);
+    mem[got / 2] = NULL;
+  }
+
+  uar_free_bulk(arenas, mem, got);
+  assert(arenas->num == numChunks(arenas));                 // Back to the starting chunk in each arena.
+
+  free(mem);
+  free(sorted);
+
+}
+
+#endif // UMEMFAST && UMEMBULK
+
+#if defined(UREALLOC)
+
+static uint32_t filled(const uint8_t * mem, uint8_t fill, uint32_t size) {
+  for (uint32_t i = 0; i < size; i++) {
+    if (mem[i] != fill) { return 0; }
+  }
+  return 1;
+}
+
+static void checkInplace(uarenas_t arenas, uint32_t spacesz) {
+
+  uint8_t * m[3];
+  uint8_t * t;
+  umemctx_t umem;
+
+  for (uint32_t i = 0; i < 3; i++) {                        // Three neighbors, in address order.
+    m[i] = uar_malloc(arenas, 64, 0xcc);
+    assert(m[i]);
+    for (uint32_t j = i; j > 0 && m[j - 1] > m[j]; j--) { t = m[j]; m[j] = m[j - 1]; m[j - 1] = t; }
+  }
+
+  memset(m[0], 0x11, 64);
+  memset(m[2], 0x33, 64);
+  umem = uar_owner(arenas, m[0]);
+
+  assert(urealloc_try_inplace(umem, m[0], 32));             // Shrinking always works ...
+  assert(chunk2size(mem2chunk(m[0])) >= 32 && filled(m[0], 0x11, 32));
+  assert(urealloc_try_inplace(umem, m[0], 64));             // ... and growing back into what it gave up too.
+  assert(chunk2size(mem2chunk(m[0])) >= 64 && filled(m[0], 0x11, 32));
+
+  uar_free(arenas, m[1]);                                   // Grow into the free successor.
+  assert(urealloc_try_inplace(umem, m[0], 128));
+  assert(chunk2size(mem2chunk(m[0])) >= 128 && filled(m[0], 0x11, 32));
+
+  assert(! urealloc_try_inplace(umem, m[0], spacesz));      // The block above is in use; nothing changes.
+  assert(chunk2size(mem2chunk(m[0])) < 128 + 64 && filled(m[0], 0x11, 32));
+  assert(mem2chunk(m[2])->tags == 0xcc && filled(m[2], 0x33, 64));
+
+  uar_free(arenas, m[0]);
+  uar_free(arenas, m[2]);
+  assert(arenas->num == numChunks(arenas));
+
+}
+
+#endif // UREALLOC
+
 static const struct option Options[] = {
   { "numthreads", 1, NULL, 'n' },
   { "space",      1, NULL, 's' },
+  { "arenas",     1, NULL, 'a' },
+  { "magazines",  0, NULL, 'm' },
+  { "stats",      0, NULL, 't' },
+  { "coalesce",   1, NULL, 'c' },
   { "help",       0, NULL, 'h' },
   { NULL,         0, NULL,  0  },
 };
@@ -189,21 +355,26 @@ static const struct option Options[] = {
 int main(int argc, char * argv[]) {
 
   uint32_t  numthr = 2;
+  uint32_t  numarenas = 1;
+  uint8_t   usemag = 0;
+  uint8_t   usestats = 0;
+  uint32_t  budget = 0;
+  pthread_t coalescer;
   uint32_t  spacesz = 1024 * 128;
   uint8_t * space;
   int32_t   o;
   int32_t   ai;                                             // Argument index.
   uint32_t  i;
   Mut_t *   muts;
-  UMemCtx_t UMem;
+  uarenas_t arenas;
   uint32_t  inuse;
+  uint32_t  chunks;
+  uint32_t  cont;
   uint32_t  seconds = 0;
   uint32_t  releasing = 0;
 
-  static const uint32_t mbyte = 1024 * 1024;
-
   do {
-    o = getopt_long(argc, argv, "hn:s:", Options, & ai);
+    o = getopt_long(argc, argv, "hn:s:a:mtc:", Options, & ai);
     switch (o) {
       case 'n': {
         numthr = (uint32_t) atoi(optarg);
@@ -214,9 +385,28 @@ int main(int argc, char * argv[]) {
 
       case 's': {
         spacesz = (uint32_t) atoi(optarg);
-        if (spacesz > (2 * mbyte) - 1) {                    // Limit to what we can represent.
-          spacesz = (2 * mbyte) - 1;
-        }
+        break;
+      }
+
+      case 'a': {
+        numarenas = (uint32_t) atoi(optarg);
+        numarenas = numarenas ? numarenas : 1;
+        numarenas = numarenas > 99 ? 99 : numarenas;        // Apply some limit.
+        break;
+      }
+
+      case 'm': {
+        usemag = 1;
+        break;
+      }
+
+      case 't': {
+        usestats = 1;
+        break;
+      }
+
+      case 'c': {
+        budget = (uint32_t) atoi(optarg);
         break;
       }
 
@@ -224,6 +414,10 @@ int main(int argc, char * argv[]) {
         printf("%s [options]\n", argv[0]);
         printf("--numthreads -n : number of mutator threads; default %u threads.\n", numthr);
         printf("--space      -s : size of the memory block to manage; default %u bytes.\n", spacesz);
+        printf("--arenas     -a : number of arenas to divide the space in; default %u arena.\n", numarenas);
+        printf("--magazines  -m : use a magazine in each mutator thread for faster allocation and release.\n");
+        printf("--stats      -t : show the statistics of each arena, every second.\n");
+        printf("--coalesce   -c : coalesce lazily with the given budget, in a coalescer thread.\n");
         printf("Runs until ctrl-c.\n");
         return 1;
         break;
@@ -231,21 +425,62 @@ int main(int argc, char * argv[]) {
     }
   } while (o != -1);                                        // Process as long as there are options.
 
+#if ! defined(UMEMHDR64)
+  if (spacesz / numarenas > UMEMMAXSPAN) {                  // Limit to what we can represent in each arena.
+    spacesz = numarenas * UMEMMAXSPAN;
+  }
+#endif
+
   muts = malloc(sizeof(Mut_t) * numthr);
   assert(muts);
   space = malloc(spacesz);
   assert(space);
+  arenas = malloc(uarenassize(numarenas));
+  assert(arenas);
 
-  uint32_t stat = initUMemCtx(& UMem, space, spacesz);
+  uint32_t stat = initUArenas(arenas, numarenas, space, spacesz);
   assert(stat);                                             // Check it was properly initialized.
-  UMem.contcb = contCb;                                     // Override do nothing contention callback.
+
+#if defined(UMEMFAST) && defined(UMEMBULK)
+  checkBulk(arenas, spacesz, 48, 64);                       // Fits the home arena.
+  checkBulk(arenas, spacesz, 200, spacesz / 200);           // Never fits; steals from the other arenas, then runs out.
+#endif
+#if defined(UREALLOC)
+  checkInplace(arenas, spacesz);
+#endif
+  for (i = 0; i < numarenas; i++) {
+    arenas->Arena[i].contcb = contCb;                       // Override do nothing contention callback.
+    arenas->Arena[i].budget = budget;
+  }
+
+  if (budget) {
+    pthread_create(& coalescer, NULL, coalesce, arenas);
+  }
+
+#if defined(UMEMSTATS)
+  UMemStats_t * stats = NULL;
+  UMemReport_t  Report;
+
+  if (usestats) {
+    stats = aligned_alloc(64, numarenas * sizeof(UMemStats_t));
+    assert(stats);
+    for (i = 0; i < numarenas; i++) {
+      initUMemStats(& arenas->Arena[i], & stats[i]);
+    }
+  }
+#else
+  if (usestats) {
+    printf("Built without statistics; -t is ignored.\n");
+  }
+#endif
 
   for (i = 0; i < numthr; i++) {
     memset(& muts[i], 0x00, sizeof(Mut_t));
     sprintf(muts[i].name, "mut %2u:", i);
     muts[i].run = 1;
     muts[i].tid = (uint8_t) i;
-    muts[i].umem = & UMem;
+    muts[i].arenas = arenas;
+    muts[i].usemag = usemag;
     pthread_create(& muts[i].thread, NULL, mutate, & muts[i]);
   }
 
@@ -256,31 +491,54 @@ int main(int argc, char * argv[]) {
     if (seconds && 0 == (seconds & 0xf)) {                  // Every 16 seconds, release for 2 seconds.
       releasing = 2;
     }
+    for (chunks = 0, cont = 0, i = 0; i < numarenas; i++) {
+      chunks += arenas->Arena[i].numchunks;
+      cont += arenas->Arena[i].count;
+      arenas->Arena[i].count = 0;
+    }
     uint32_t s = ++seconds;
     uint32_t d = s / (3600 * 24); s -= d * 3600 * 24;
     uint32_t h = s / 3600;        s -= h * 3600;
     uint32_t m = s / 60;          s -= m * 60;
-    printf("%u chunk%s, %u cont/sec, %u day%s, %u hour%s, %u minute%s, %u second%s%s.\n",
-        UMem.numchunks,  UMem.numchunks == 1 ? "" : "s",
-        UMem.count,
+    printf("%u chunk%s, %u cont/sec, %u steals, %u day%s, %u hour%s, %u minute%s, %u second%s%s.\n",
+        chunks,  chunks == 1 ? "" : "s",
+        cont,
+        arenas->steals,
         d, d == 1 ? "" : "s",
         h, h == 1 ? "" : "s",
         m, m == 1 ? "" : "s",
         s, s == 1 ? "" : "s",
         releasing ? ", only release" : "");
-    UMem.count = 0;
     inuse = 0;
     for (i = 0; i < numthr; i++) {
       printf("%s %"PRIu64" operations, %u in use.\n", muts[i].name, muts[i].ops, muts[i].inuse);
       inuse += muts[i].inuse;
       muts[i].releaseonly = releasing ? 1 : 0;
     }
-    printf("%u bytes in use of %u; %u chunk%s.\n",
+    printf("%u bytes in use of %u; %u chunk%s in %u arena%s.\n",
       inuse, spacesz,
-      UMem.numchunks, UMem.numchunks == 1 ? "" : "s");
-    if (check4zero) { UMem.clean(& UMem); }                 // If checking for leaks, clean up the context first.
+      chunks, chunks == 1 ? "" : "s",
+      numarenas, numarenas == 1 ? "" : "s");
+#if defined(UMEMSTATS)
+    for (i = 0; stats && i < numarenas; i++) {
+      uint32_t complete = ustats(& arenas->Arena[i], & Report);
+      uint64_t calls = Report.calls[UMemOp_Malloc] ? Report.calls[UMemOp_Malloc] : 1;
+      printf("arena %2u: %u used, %u free, largest %"PRIu64", frag %u permille, %"PRIu64".%02"PRIu64" visits/umalloc, "
+             "retries %"PRIu64"/%"PRIu64"/%"PRIu64"/%"PRIu64" malloc/fast/free/realloc, "
+             "reallocs %"PRIu64"/%"PRIu64"/%"PRIu64" in place/shifted/moved%s.\n",
+        i, Report.numused, Report.numfree, (uint64_t) Report.largest, Report.frag,
+        Report.visits[UMemOp_Malloc] / calls, Report.visits[UMemOp_Malloc] * 100 / calls % 100,
+        Report.retries[UMemOp_Malloc], Report.retries[UMemOp_Fast],
+        Report.retries[UMemOp_Free], Report.retries[UMemOp_Realloc],
+        Report.calls[UMemOp_InPlace], Report.calls[UMemOp_Shifted], Report.calls[UMemOp_Moved],
+        complete ? "" : ", incomplete walk");
+    }
+#endif
+    if (check4zero) {                                       // If checking for leaks, clean up the arenas first.
+      chunks = numChunks(arenas);
+    }
     assert(! check4zero || 0 == inuse);                     // Check for leaks.
-    assert(! check4zero || 1 == UMem.numchunks);            // Should have coagulated into starting chunk.
+    assert(! check4zero || numarenas == chunks);            // Should have coagulated into starting chunks.
   }
 
   return 0;
@@ -0,0 +1,220 @@
+// Copyright 2024 Steven Buytaert
+
+#include <umem-arenas.h>
+#include <string.h>
+
+typedef enum {                    // Flavour of allocation to perform in an arena.
+  UAr_Best        = 0,
+  UAr_Fast        = 1,
+  UAr_Aligned     = 2,
+} UArHow_t;
+
+static uint32_t tickets;          // Number of thread tickets handed out.
+
+static __thread uint32_t ticket;  // Ticket of this thread; 0 when not yet assigned.
+
+static uint32_t pick(uarenas_t arenas) {                    // Default home arena picker; round robin over threads.
+
+  if (! ticket) {                                           // First time this thread comes here.
+    ticket = __atomic_add_fetch(& tickets, 1, __ATOMIC_SEQ_CST);
+  }
+
+  return (ticket - 1) % arenas->num;
+
+}
+
+umemctx_t uar_home(uarenas_t arenas) {
+
+  uint32_t home = arenas->pick(arenas);
+
+  assert(home < arenas->num);
+
+  return & arenas->Arena[home];
+
+}
+
+umemctx_t uar_owner(uarenas_t arenas, const void * mem) {
+
+  uintptr_t offset = (uintptr_t) mem - (uintptr_t) arenas->space;
+
+  assert(mem && (uint8_t *) mem > arenas->space);           // Must be a block from this set of arenas.
+  assert(offset / arenas->slice < arenas->num);
+
+  return & arenas->Arena[offset / arenas->slice];
+
+}
+
+static void * arena2mem(umemctx_t umem, uint32_t sz, uint8_t tags, uint32_t align, UArHow_t how) {
+
+  void * mem = NULL;
+
+  switch (how) {
+    case UAr_Best: {
+      mem = umalloc(umem, sz, tags);
+      break;
+    }
+
+#if defined(UMEMFAST)
+    case UAr_Fast: {
+      mem = umalloc_fast(umem, sz, tags);
+      break;
+    }
+#endif
+
+#if defined(UAMALLOC)
+    case UAr_Aligned: {
+      mem = uamalloc(umem, sz, tags, align);
+      break;
+    }
+#endif
+
+    default: break;
+  }
+
+  return mem;
+
+}
+
+static void * steal(uarenas_t arenas, uint32_t sz, uint8_t tags, uint32_t align, UArHow_t how, umemctx_t skip) {
+
+  uint32_t  home = arenas->pick(arenas);
+  umemctx_t umem = & arenas->Arena[home];
+  void *    mem = NULL;
+
+  if (umem != skip) {
+    mem = arena2mem(umem, sz, tags, align, how);            // Try home arena first.
+  }
+
+  for (uint32_t i = 1; ! mem && i < arenas->num; i++) {     // Then try the neighbors, in sequence.
+    umem = & arenas->Arena[(home + i) % arenas->num];
+    if (umem == skip) { continue; }
+    mem = arena2mem(umem, sz, tags, align, how);
+    if (mem) { __atomic_add_fetch(& arenas->steals, 1, __ATOMIC_RELAXED); }
+  }
+
+  return mem;
+
+}
+
+void * uar_malloc(uarenas_t arenas, uint32_t sz, uint8_t tags) {
+  return steal(arenas, sz, tags, 0, UAr_Best, NULL);
+}
+
+void uar_free(uarenas_t arenas, void * mem) {
+
+  if (mem) { ufree(uar_owner(arenas, mem), mem); }
+
+}
+
+#if defined(UMEMFAST)
+
+void * uar_malloc_fast(uarenas_t arenas, uint32_t sz, uint8_t tags) {
+  return steal(arenas, sz, tags, 0, UAr_Fast, NULL);
+}
+
+void uar_free_fast(uarenas_t arenas, void * mem) {
+
+  if (mem) { ufree_fast(uar_owner(arenas, mem), mem); }
+
+}
+
+#if defined(UMEMBULK)
+
+uint32_t uar_malloc_bulk(uarenas_t arenas, uint32_t sz, uint32_t num, void * mem[], uint8_t tags) {
+
+  uint32_t home = arenas->pick(arenas);
+  uint32_t got = umalloc_bulk(& arenas->Arena[home], sz, num, mem, tags);
+  uint32_t more;
+
+  for (uint32_t i = 1; got < num && i < arenas->num; i++) { // Steal the rest from the neighbors.
+    more = umalloc_bulk(& arenas->Arena[(home + i) % arenas->num], sz, num - got, & mem[got], tags);
+    if (more) { __atomic_add_fetch(& arenas->steals, 1, __ATOMIC_RELAXED); }
+    got += more;
+  }
+
+  return got;
+
+}
+
+void uar_free_bulk(uarenas_t arenas, void * mem[], uint32_t num) {
+
+  umemctx_t owner;
+  void *    m;
+  uint32_t  i;
+  uint32_t  j;
+  uint32_t  k;
+
+  for (i = 0; i < num; i = k) {
+    k = i + 1;
+    if (! mem[i]) { continue; }
+    owner = uar_owner(arenas, mem[i]);
+    for (j = k; j < num; j++) {                             // Gather the other blocks of this owner.
+      if (mem[j] && uar_owner(arenas, mem[j]) == owner) {
+        m = mem[k]; mem[k++] = mem[j]; mem[j] = m;
+      }
+    }
+    ufree_bulk(owner, & mem[i], k - i);
+  }
+
+}
+
+#endif // UMEMBULK
+
+#endif // UMEMFAST
+
+#if defined(UREALLOC)
+
+void * uar_realloc(uarenas_t arenas, void * mem, uint32_t size, uint8_t tags) {
+
+  umemctx_t owner;
+  chunk_t   chunk;
+  void *    newmem;
+
+  if (! mem) { return uar_malloc(arenas, size, tags); }     // Work as malloc.
+
+  owner = uar_owner(arenas, mem);
+  newmem = urealloc(owner, mem, size, tags);
+
+  if (! newmem && size && size <= UMEMMAXSIZE) {            // Owner could not grow it; try the other arenas.
+    chunk = mem2chunk(mem);                                 // Size and tags of an in use chunk are stable.
+    newmem = steal(arenas, size, chunk->tags, 0, UAr_Best, owner);
+    if (newmem) {
+      memcpy(newmem, mem, chunk2size(chunk));
+      ufree(owner, mem);
+    }
+  }
+
+  return newmem;
+
+}
+
+#endif // UREALLOC
+
+#if defined(UAMALLOC)
+
+void * uar_amalloc(uarenas_t arenas, uint32_t sz, uint8_t tags, uint32_t align) {
+  return steal(arenas, sz, tags, align, UAr_Aligned, NULL);
+}
+
+#endif // UAMALLOC
+
+uint32_t initUArenas(uarenas_t arenas, uint32_t num, uint8_t space[], uint32_t sz) {
+
+  uint32_t stat = 0;
+  uint32_t i;
+
+  memset(arenas, 0x00, sizeof(UArenas_t));
+
+  if (space && num) {
+    arenas->num   = num;
+    arenas->space = space;
+    arenas->slice = (sz / num) & ~0b111u;                   // Keep each slice a multiple of 8 bytes.
+    arenas->pick  = pick;
+    for (stat = 1, i = 0; stat && i < num; i++) {
+      stat = initUMemCtx(& arenas->Arena[i], & space[i * arenas->slice], arenas->slice);
+    }
+  }
+
+  return stat;
+
+}
@@ -0,0 +1,82 @@
+// Copyright 2024 Steven Buytaert
+
+#ifndef UMEMARENAS_H
+#define UMEMARENAS_H
+
+#include <umem.h>
+
+/*
+  A sharded front end over a number of independent micro memory contexts,
+  called arenas. Each umem context starts every allocation scan at its start
+  chunk, so when many threads allocate from the same context, they all try
+  to lock the same first chunks. Here the user space is divided in equal
+  slices, one for each arena. Each thread has a home arena, that it will use
+  first; only when the home arena can not satisfy the request, the
+  neighboring arenas are tried, in sequence; this is called stealing.
+
+  Since the arenas are contiguous slices of the user space, the arena that
+  owns a memory block can be found back from the block address, so releasing
+  and reallocating always go to the proper owning arena.
+
+  As a side effect, the total space managed by a set of arenas can be larger
+  than what a single umem context can manage.
+*/
+
+typedef struct UArenas_t * uarenas_t;
+
+typedef uint32_t (*upick_t)(uarenas_t arenas);
+
+typedef struct UArenas_t {        // A set of micro memory arenas.
+  uint32_t        num;            // Number of arenas in the Arena array.
+  uint32_t        slice;          // Number of bytes of space given to each arena.
+  uint8_t *       space;          // Space provided by the user, divided over the arenas.
+  upick_t         pick;           // Return home arena index for calling thread; default hands out round robin tickets.
+  uint32_t        steals;         // Number of allocations served by a non home arena.
+  uint8_t         pad[4];
+  UMemCtx_t       Arena[];        // The arenas; num elements follow.
+} UArenas_t;
+
+#define uarenassize(N) (sizeof(UArenas_t) + (N) * sizeof(UMemCtx_t))  // Bytes required for N arenas.
+
+// Initialize num arenas over the given space; the arenas structure must be at
+// least uarenassize(num) bytes. Returns zero when the space can not be divided
+// properly, i.e. when a slice would be too small or too large for a umem context.
+
+uint32_t initUArenas(uarenas_t arenas, uint32_t num, uint8_t space[], uint32_t sz);
+
+umemctx_t uar_home(uarenas_t arenas);                       // Return the home arena of the calling thread.
+umemctx_t uar_owner(uarenas_t arenas, const void * mem);    // Return the arena owning the memory block.
+
+void *    uar_malloc(uarenas_t arenas, uint32_t sz, uint8_t tags);
+void      uar_free(uarenas_t arenas, void * mem);
+
+#if defined(UMEMFAST)
+void *    uar_malloc_fast(uarenas_t arenas, uint32_t sz, uint8_t tags);
+void      uar_free_fast(uarenas_t arenas, void * mem);
+
+#if defined(UMEMBULK)
+
+// Allocate a burst of blocks from the home arena; when it can not give them all,
+// the rest is stolen from the neighbors. Release a burst of blocks; the array is
+// reordered in place, so that the blocks of each owning arena are released in one go.
+
+uint32_t  uar_malloc_bulk(uarenas_t arenas, uint32_t sz, uint32_t num, void * mem[], uint8_t tags);
+void      uar_free_bulk(uarenas_t arenas, void * mem[], uint32_t num);
+#endif // UMEMBULK
+
+#endif // UMEMFAST
+
+#if defined(UREALLOC)
+
+// Reallocate in the owning arena first; when that fails for growing, a new block
+// is allocated from the home arena or stolen, the contents are copied and the
+// old block is released.
+
+void *    uar_realloc(uarenas_t arenas, void * mem, uint32_t size, uint8_t tags);
+#endif // UREALLOC
+
+#if defined(UAMALLOC)
+void *    uar_amalloc(uarenas_t arenas, uint32_t sz, uint8_t tags, uint32_t align);
+#endif // UAMALLOC
+
+#endif // UMEMARENAS_H
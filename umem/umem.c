@@ -8,6 +8,59 @@
 
 #define CAX(P, X, D) __atomic_compare_exchange(P, X, D, 0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST)
 
+#if defined(UMEMSTATS)
+
+typedef struct Mark_t {           // Work done by a thread; an operation adds the difference to its stripe.
+  uint32_t retries;
+  uint32_t visits;
+} Mark_t;
+
+static __thread Mark_t Work;      // Work done by this thread, so far.
+
+static __thread uint32_t stripe;  // Stripe of this thread plus 1; 0 when not yet assigned.
+
+static uint32_t stripes;          // Number of stripes handed out.
+
+static void retry(void) { Work.retries++; }
+
+static void visit(void) { Work.visits++; }
+
+static Mark_t mark(void) { return Work; }
+
+static void tally(umemctx_t umem, UMemOp_t op, Mark_t Mark) { // Add work done since Mark to the stripe.
+
+  UMemStripe_t * s;
+
+  if (umem->stats) {
+    if (! stripe) {                                         // First time this thread comes here.
+      stripe = __atomic_add_fetch(& stripes, 1, __ATOMIC_RELAXED) % UMEMSTRIPES + 1;
+    }
+    s = & umem->stats->Stripe[stripe - 1];
+    __atomic_add_fetch(& s->calls[op], 1, __ATOMIC_RELAXED);
+    if (Work.retries != Mark.retries) {
+      __atomic_add_fetch(& s->retries[op], Work.retries - Mark.retries, __ATOMIC_RELAXED);
+    }
+    if (Work.visits != Mark.visits) {
+      __atomic_add_fetch(& s->visits[op], Work.visits - Mark.visits, __ATOMIC_RELAXED);
+    }
+  }
+
+}
+
+#else
+
+typedef uint8_t Mark_t;
+
+static void retry(void) { }
+
+static void visit(void) { }
+
+static Mark_t mark(void) { return 0; }
+
+#define tally(U, O, M) (void) (M)
+
+#endif // UMEMSTATS
+
 static uint32_t trylock(chunk_t chunk) {
 
   Chunk_t Exp = { .header = chunk->header };
@@ -16,7 +69,11 @@ static uint32_t trylock(chunk_t chunk) {
   Exp.lock = 0;
   Des.lock = 1;
 
-  return CAX(& chunk->header, & Exp.header, & Des.header);
+  if (CAX(& chunk->header, & Exp.header, & Des.header)) { return 1; }
+
+  retry();
+
+  return 0;
 
 }
 
@@ -42,7 +99,7 @@ static void atomic_dec32(uint32_t * where) {
   __atomic_sub_fetch(where, 1, __ATOMIC_SEQ_CST);
 }
 
-static uint32_t roundup(uint32_t value, uint32_t po2) {     // Round up to a given power of 2.
+static usize_t roundup(usize_t value, usize_t po2) {       // Round up to a given power of 2.
   return (value + (po2 - 1)) & ~(po2 - 1);
 }
 
@@ -50,14 +107,40 @@ static uintptr_t aroundup(uintptr_t value, uintptr_t po2) { // Round up the pass
   return (value + (po2 - 1)) & ~(po2 - 1);
 }
 
-static chunk_t split(chunk_t c2s, uint32_t size) {          // Split at given size; return remainder.
+// The span of each chunk is a multiple of sizeunit bytes. The user memory of the
+// start chunk is aligned on startalign bytes, so that in granule mode, the user
+// memory of all chunks is aligned on the granule.
+
+static const uint32_t sizeunit = UMEMGRAN > sizeof(uhdr_t) ? UMEMGRAN : sizeof(uhdr_t);
+static const uint32_t startalign = UMEMGRAN > 8 ? UMEMGRAN : 8;
+
+static usize_t sizeup(usize_t size) {                       // Round up size so the span is a whole number of units.
+  return roundup(size + chunkhdrsz, sizeunit) - chunkhdrsz;
+}
+
+static usize_t fitsize(uint32_t sz) {                       // Return chunk size required for sz bytes; 0 if too large.
+
+  if (sz < minchunksize) { sz = minchunksize; }             // Ensure we have a proper size.
+  if (sz > UMEMMAXSIZE - sizeunit) { return 0; }            // Too large.
+
+  return sizeup(sz);
+
+}
+
+#if defined(UMEMHDR64)
+#define clz(S) __builtin_clzll(S)
+#else
+#define clz(S) __builtin_clz(S)
+#endif
+
+static chunk_t split(chunk_t c2s, usize_t size) {           // Split at given size; return remainder.
 
   Mem_t    Succ = { .chunk = c2s };
-  uint32_t sucsize = c2s->size - size - chunkhdrsz;         // Successor size.
+  usize_t  sucsize = chunk2size(c2s) - size - chunkhdrsz;   // Successor size.
 
   assert(c2s->lock);                                        // Must be locked.
-  assert(size == roundup(size, chunkhdrsz));                // Should have been properly rounded already.
-  assert(c2s->size >= size);                                // Chunk should be big enough for requested split.
+  assert(size == sizeup(size));                             // Should have been properly rounded already.
+  assert(chunk2size(c2s) >= size);                          // Chunk should be big enough for requested split.
 
   assert(sucsize >= minchunksize + 4);                      // +4 amount we might need for alignment.
   Succ.addr += size + chunkhdrsz;
@@ -69,8 +152,8 @@ static chunk_t split(chunk_t c2s, uint32_t size) {          // Split at given si
   }
 
   Succ.chunk->header = 0;                                   // Clear the whole header size/ciu/lock/pif.
-  Succ.chunk->size = iusize(sucsize);
-  c2s->size = iusize(size);
+  size2chunk(Succ.chunk, sucsize);
+  size2chunk(c2s, size);
   assert(chunk2succ(c2s) == Succ.chunk);                    // Check our size calculations.
   assert(alignedok(Succ.chunk->u08));
 
@@ -83,12 +166,183 @@ static chunk_t merge(chunk_t c2m, chunk_t suc) {            // Merge chunk with
   assert(c2m->lock && suc->lock);                           // Both must be locked.
   assert(chunk2succ(c2m) == suc);                           // Must really be the successor.
 
-  c2m->size = iusize(c2m->size + suc->size + chunkhdrsz);   // First set proper final size.
+  c2m->size = iusize(c2m->size + suc->size);                // First set proper final size; spans add up.
 
   return chunk2succ(c2m);                                   // Return new successor.
 
 }
 
+#if defined(UMEMBINS)
+
+typedef struct Links_t * links_t;
+
+typedef struct Links_t {          // Bin links, kept in the user memory of a free chunk.
+  chunk_t next;
+  chunk_t prev;
+} Links_t;
+
+static links_t chunk2links(chunk_t chunk) {
+  return (links_t) chunk->u08;
+}
+
+static uint32_t size2bin(usize_t size) {                    // Return the bin for a chunk of the given size.
+
+  uint32_t bin = (uint32_t) (clz((usize_t) minchunksize) - clz(size));
+
+  assert(size >= minchunksize);
+
+  return bin < UMEMBINS ? bin : UMEMBINS - 1;
+
+}
+
+static uint32_t trylockbin(umemctx_t umem, uint32_t bin) {
+
+  uint32_t bit = 1u << bin;
+
+  if (! (__atomic_fetch_or(& umem->binlocks, bit, __ATOMIC_ACQUIRE) & bit)) { return 1; }
+
+  retry();
+
+  return 0;
+
+}
+
+static void lockbin(umemctx_t umem, uint32_t bin) {         // Bin lock holders never wait, so spinning is OK.
+
+  while (! trylockbin(umem, bin)) { umem->contcb(umem); }
+
+}
+
+static void unlockbin(umemctx_t umem, uint32_t bin) {
+
+  assert(umem->binlocks & (1u << bin));
+
+  __atomic_fetch_and(& umem->binlocks, ~(1u << bin), __ATOMIC_RELEASE);
+
+}
+
+/*
+  Add a free chunk to its bin or remove it; the chunk must be locked by the
+  caller. A free chunk can only change its size after it has been removed
+  from its bin, so the bin can always be recalculated from the size. When
+  wait is zero, only a single attempt is made to get the bin lock; this is
+  used from the uncontended paths, that may never deadlock. Return non zero
+  when done.
+*/
+
+static uint32_t bin(umemctx_t umem, chunk_t chunk, uint32_t wait) {
+
+  uint32_t b = size2bin(chunk2size(chunk));
+  links_t  links = chunk2links(chunk);
+
+  assert(chunk->lock && ! chunk->ciu);
+
+  if (wait) { lockbin(umem, b); }
+  else if (! trylockbin(umem, b)) { return 0; }
+
+  links->prev = NULL;                                       // Add in front.
+  links->next = umem->bins[b];
+  if (links->next) {
+    chunk2links(links->next)->prev = chunk;
+  }
+  umem->bins[b] = chunk;
+  __atomic_fetch_or(& umem->binmap, 1u << b, __ATOMIC_RELAXED);
+
+  unlockbin(umem, b);
+
+  return 1;
+
+}
+
+static void unlink4bin(umemctx_t umem, chunk_t chunk, uint32_t b) {  // Unlink chunk; bin must be locked.
+
+  links_t links = chunk2links(chunk);
+
+  if (links->prev) {
+    chunk2links(links->prev)->next = links->next;
+  }
+  else {
+    assert(umem->bins[b] == chunk);
+    umem->bins[b] = links->next;
+  }
+
+  if (links->next) {
+    chunk2links(links->next)->prev = links->prev;
+  }
+
+  if (! umem->bins[b]) {
+    __atomic_fetch_and(& umem->binmap, ~(1u << b), __ATOMIC_RELAXED);
+  }
+
+}
+
+static uint32_t unbin(umemctx_t umem, chunk_t chunk, uint32_t wait) {
+
+  uint32_t b = size2bin(chunk2size(chunk));
+
+  assert(chunk->lock);
+
+  if (wait) { lockbin(umem, b); }
+  else if (! trylockbin(umem, b)) { return 0; }
+
+  unlink4bin(umem, chunk, b);
+
+  unlockbin(umem, b);
+
+  return 1;
+
+}
+
+static const uint32_t maxbinscan = 8;                       // Maximum number of chunks to consider in a bin.
+
+// Pop a chunk of at least iter->size from the bins; a found chunk is unbinned,
+// claimed in use and locked, together with its successor, just like a scan
+// with firstFitCb would leave it. Return non zero when a chunk was found.
+
+static uint32_t pop(umemiter_t iter) {
+
+  umemctx_t umem = iter->umem;
+  uint32_t  b = size2bin(iter->size);
+  uint32_t  map = umem->binmap >> b;                        // Take snapshot of non empty bins, from ours up.
+  uint32_t  scan;
+  chunk_t   c;
+
+  for ( ; map; map >>= 1, b++) {
+    if (! (map & 1)) { continue; }                          // Empty bin.
+    if (! trylockbin(umem, b)) { continue; }                // Don't wait; try the next bin.
+    for (c = umem->bins[b], scan = 0; c && scan < maxbinscan; c = chunk2links(c)->next, scan++) {
+      if (chunk2size(c) < iter->size) { continue; }         // Can only happen in the first bin.
+      if (! trylock(c)) { continue; }
+      iter->succ2found = chunk2succ(c);
+      if (! trylock(iter->succ2found)) { unlock(c); continue; }
+      assert(! c->ciu);                                     // Claimed chunks are kept locked.
+      unlink4bin(umem, c, b);
+      c->ciu = 1;                                           // Claim it.
+      iter->found = c;
+      unlockbin(umem, b);
+      return 1;
+    }
+    unlockbin(umem, b);
+  }
+
+  return 0;
+
+}
+
+#else
+
+static uint32_t bin(umemctx_t umem, chunk_t chunk, uint32_t wait) {
+  (void) umem; (void) chunk; (void) wait; return 1;
+}
+
+static uint32_t unbin(umemctx_t umem, chunk_t chunk, uint32_t wait) {
+  (void) umem; (void) chunk; (void) wait; return 1;
+}
+
+static uint32_t pop(umemiter_t iter) { (void) iter; return 0; }
+
+#endif // UMEMBINS
+
 static uint32_t start2end(umemiter_t iter, chunk_t start, chunk_t end) {
 
   chunk_t  c;
@@ -103,6 +357,7 @@ static uint32_t start2end(umemiter_t iter, chunk_t start, chunk_t end) {
       return 0;
     }
 
+    visit();
     stat = iter->cb(iter, c);
 
     switch (stat) {
@@ -185,6 +440,7 @@ static void freechunk(umemctx_t umem, chunk_t c2free) {     // Slow path to rele
         while (! succ->ciu) {                               // Forward coalescing; end chunk has ciu set ...
           succ2 = chunk2succ(succ);                         // ... so it will stop there.
           if (! trylock(succ2)) { break; }                  // Try again next time.
+          unbin(umem, succ, 1);                             // Free chunks are binned.
           merge(c2free, succ);
           assert((succ->header = 0, 1));                    // Clear when debugging; succ no longer exists.
           atomic_dec32(& umem->numchunks);
@@ -195,6 +451,7 @@ static void freechunk(umemctx_t umem, chunk_t c2free) {     // Slow path to rele
           pred = c2free->prev;                              // ... clear, so will stop there.
           if (! trylock(pred)) { break; }                   // Try again next time.
           assert(! pred->ciu);                              // Can not be in use when pif is set in our chunk.
+          unbin(umem, pred, 1);                             // It will grow, so it changes bin.
           merge(pred, c2free);                              // Returned succ is invariant! Same as before.
           atomic_dec32(& umem->numchunks);
           assert((c2free->header = 0, 1));                  // Clear when debugging; no longer exists.
@@ -204,6 +461,7 @@ static void freechunk(umemctx_t umem, chunk_t c2free) {     // Slow path to rele
         succ->prev = c2free;
         succ->pif = 1;
         c2free->ciu = 0;                                    // No longer in use.
+        bin(umem, c2free, 1);
         unlock(succ);
       }
       unlock(c2free);                                       // Done or redoing. Release lock in any case.
@@ -226,30 +484,104 @@ static chunk_t chunk2next(chunk_t chunk) {                  // From a chunk, ret
   return ((list_t) chunk->u08)->next;
 }
 
+static void chain2free(umemctx_t umem, chunk_t first, chunk_t last) { // Atomically push a chain of in use chunks.
+
+  list_t  list = (list_t) last->u08;                        // Chain is already linked from first to last.
+  chunk_t exp;
+
+  assert(sizeof(List_t) <= minchunksize);                   // Must fit in the minimum chunk.
+  assert(first->ciu && last->ciu);
+
+  while (1) {                                               // Atomically insert in the list.
+    list->next = umem->c2free;                              // Take snapshot and reuse ...
+    exp = list->next;                                       // ... here; do *NOT* read umem->c2free again!
+    if (CAX(& umem->c2free, & exp, & first)) { break; }
+    retry();
+  }
+
+}
+
+static void push2free(umemctx_t umem, chunk_t chunk) {      // Atomically push an in use chunk on the c2free list.
+  chain2free(umem, chunk, chunk);
+}
 
-static void clean(umemctx_t umem) {                         // Release chunks of to be freed list, if any.
+static chunk_t detach(umemctx_t umem) {                     // Atomically unlink and return the c2free list.
 
   chunk_t c2free;
-  chunk_t next;
   chunk_t des;
 
-  do {                                                      // Atomically unlink the c2free list.
+  do {
     c2free = umem->c2free;
     des = NULL;
   } while (! CAX(& umem->c2free, & c2free, & des));
 
-  for ( ; c2free; c2free = next) {                          // If there are chunks to be freed, free them.
-    next = chunk2next(c2free);                              // Get next *before* freeing the chunk.
-    freechunk(umem, c2free);
+  return c2free;
+
+}
+
+// Release at most budget chunks, first from the backlog, then from the c2free
+// list. The caller that swaps the busy marker into the backlog owns it, until
+// it stores the chunks it could not release back. When the backlog is busy, a
+// limited caller returns right away, an unlimited one only does the c2free
+// list. Returns non zero when chunks remain to be released.
+
+static uint32_t coalesce(umemctx_t umem, uint32_t budget) {
+
+  chunk_t  busy = (chunk_t) & umem->backlog;                 // Marker; can not be a chunk.
+  chunk_t  list;
+  chunk_t  next;
+  uint32_t owner;
+  uint32_t detached = 0;
+
+  if (! __atomic_load_n(& umem->backlog, __ATOMIC_RELAXED) && ! __atomic_load_n(& umem->c2free, __ATOMIC_RELAXED)) {
+    return 0;                                               // Nothing to do; don't write the shared line for it.
   }
 
+  list = __atomic_exchange_n(& umem->backlog, busy, __ATOMIC_SEQ_CST);
+  owner = (list != busy);
+
+  if (! owner) {
+    if (budget != UINT32_MAX) { return 1; }                 // Someone else is at it.
+    list = NULL;
+  }
+
+  for ( ; budget; budget--, list = next) {
+    if (! list) {                                           // Backlog done; take the c2free list, once.
+      if (detached) { break; }
+      list = detach(umem);
+      detached = 1;
+      if (! list) { break; }
+    }
+    next = chunk2next(list);                                // Get next *before* freeing the chunk.
+    freechunk(umem, list);
+  }
+
+  if (owner) {
+    __atomic_store_n(& umem->backlog, list, __ATOMIC_SEQ_CST);
+  }
+
+  return ! owner || list || umem->c2free;                   // Not owning, the backlog may still hold chunks.
+
+}
+
+static void clean(umemctx_t umem) {                         // Release all chunks of to be freed list, if any.
+  coalesce(umem, UINT32_MAX);
+}
+
+static void tidy(umemctx_t umem) {                          // Release to be freed chunks, within the budget, if any.
+  coalesce(umem, umem->budget ? umem->budget : UINT32_MAX);
+}
+
+uint32_t ucoalesce(umemctx_t umem, uint32_t budget) {
+  return budget ? coalesce(umem, budget) : umem->c2free || umem->backlog;
 }
 
 void ufree(umemctx_t umem, void * mem) {                    // Slow path to release memory.
 
   chunk_t chunk;
+  Mark_t  Mark = mark();
 
-  clean(umem);                                              // Clean any from the free list first.
+  tidy(umem);                                               // Clean any from the free list first.
 
   if (mem) {
     chunk = mem2chunk(mem);
@@ -257,10 +589,36 @@ void ufree(umemctx_t umem, void * mem) {                    // Slow path to rele
     freechunk(umem, chunk);
   }
 
+  tally(umem, UMemOp_Free, Mark);
+
 }
 
 static const uint32_t enough2split = minchunksize + 2 * chunkhdrsz;
 
+// Bin the remainder of a split; both the split chunk and its successor are
+// still locked, so nobody else can reach the remainder yet. When not waiting
+// for the bin lock and it is taken, the remainder is claimed and put on the
+// c2free list instead; it will be binned by a later clean.
+
+static void binsplit(umemctx_t umem, chunk_t rem, chunk_t succ, uint32_t wait) {
+
+#if defined(UMEMBINS)
+  trylock(rem);                                             // Can not fail, see above.
+  if (bin(umem, rem, wait)) {
+    unlock(rem);
+  }
+  else {
+    rem->ciu = 1;
+    succ->pif = 0;                                          // Remainder is now in use.
+    unlock(rem);
+    push2free(umem, rem);
+  }
+#else
+  (void) umem; (void) rem; (void) succ; (void) wait;
+#endif
+
+}
+
 static void * iter2mem(umemiter_t iter, uint8_t tags) {     // Use found iterator chunk for memory, if any.
 
   umemctx_t umem = iter->umem;
@@ -274,13 +632,14 @@ static void * iter2mem(umemiter_t iter, uint8_t tags) {     // Use found iterato
     succ = iter->succ2found;
     assert(succ->lock);                                     // Iterator guarantee.
     assert(succ->pif);                                      // Since its predecessor is free.
-    if (iter->found->size - iter->size >= enough2split) {   // Big enough remainder to split.
+    if (chunk2size(iter->found) - iter->size >= enough2split) { // Big enough remainder to split.
       rem = split(iter->found, iter->size);
       assert((trylock(rem), 1));                            // Only for chunk2succ in next assert.
       assert(succ == chunk2succ(rem));                      // its successor has been locked already, but ...
       assert((unlock(rem), 1));
       succ->prev = rem;                                     // ... it has a new predecessor.
       atomic_inc32(& umem->numchunks);
+      binsplit(umem, rem, succ, 0);
     }
     else {
       succ->pif = 0;
@@ -309,11 +668,10 @@ static void search4chunk(UMemIter_t *iter, uint32_t sz, uint32_t needcomplete) {
   uint32_t   count = 0;
   uint32_t   breakat = umem->breakat;                       // Take snapshot.
 
-  clean(umem);                                              // Do any cleanup first.
+  tidy(umem);                                               // Do any cleanup first.
 
-  if (sz < minchunksize) { sz = minchunksize; }             // Ensure we have a proper size.
-  if (sz > iusize(sz)) { iter->found = NULL; return; }      // Too large.
-  iter->size = roundup(sz, chunkhdrsz);
+  iter->size = fitsize(sz);
+  if (! iter->size) { iter->found = NULL; return; }         // Too large.
 
   do {
     iter->found = NULL;
@@ -347,8 +705,8 @@ static UMemItStat_t bestFitCb(umemiter_t iter, chunk_t c) { // Best fit walking
   assert(iter->succ == chunk2succ(c));
   assert(iter->succ->lock);
 
-  if (! c->ciu && c->size >= iter->size) {                  // Free and big enough?
-    if (iter->found && c->size < iter->found->size) {       // A tighter fit.
+  if (! c->ciu && chunk2size(c) >= iter->size) {            // Free and big enough?
+    if (iter->found && chunk2size(c) < chunk2size(iter->found)) {  // A tighter fit.
       assert(iter->found->lock);                            // Both found and ...
       assert(iter->succ2found->lock);                       // its successor should have been kept locked.
       iter->found->ciu = 0;                                 // We no longer claim it in use.
@@ -371,7 +729,7 @@ static UMemItStat_t bestFitCb(umemiter_t iter, chunk_t c) { // Best fit walking
 
 }
 
-void * umalloc(umemctx_t umem, uint32_t sz, uint8_t tags) { // Slow path umalloc.
+static void * bestfit(umemctx_t umem, uint32_t sz, uint8_t tags) {
 
   UMemIter_t Iter = {
     .umem = umem,
@@ -380,10 +738,28 @@ void * umalloc(umemctx_t umem, uint32_t sz, uint8_t tags) { // Slow path umalloc
 
   search4chunk(& Iter, sz, 1);                              // Search for a fitting chunk; complete scan.
 
+  if (! Iter.found && umem->budget && (umem->c2free || umem->backlog)) {
+    clean(umem);                                            // Lazy; release all waiting chunks and retry.
+    search4chunk(& Iter, sz, 1);
+  }
+
+  if (Iter.found) { unbin(umem, Iter.found, 1); }           // Take it out of its bin.
+
   return iter2mem(& Iter, tags);
 
 }
 
+void * umalloc(umemctx_t umem, uint32_t sz, uint8_t tags) { // Slow path umalloc.
+
+  Mark_t Mark = mark();
+  void * mem = bestfit(umem, sz, tags);
+
+  tally(umem, UMemOp_Malloc, Mark);
+
+  return mem;
+
+}
+
 #if defined(UMEMFAST)
 
 static UMemItStat_t firstFitCb(umemiter_t iter, chunk_t c) {// First fit walking over all chunks.
@@ -394,7 +770,7 @@ static UMemItStat_t firstFitCb(umemiter_t iter, chunk_t c) {// First fit walking
   assert(iter->succ == chunk2succ(c));
   assert(iter->succ->lock);
 
-  if (! c->ciu && c->size >= iter->size) {                  // Free and big enough?
+  if (! c->ciu && chunk2size(c) >= iter->size) {            // Free and big enough?
     iter->found = c;
     iter->succ2found = iter->succ;
     c->ciu = 1;                                             // Claim it in use already.
@@ -416,42 +792,311 @@ void * umalloc_fast(umemctx_t umem, uint32_t sz, uint8_t tags) {
   };
 
   uint32_t  count = 0;
+  Mark_t    Mark = mark();
+  void *    mem;
 
-  if (sz < minchunksize) { sz = minchunksize; }             // Ensure we have a proper size.
-  if (sz > iusize(sz)) { return NULL; }                     // Too large.
-  Iter.size = roundup(sz, chunkhdrsz);
+  Iter.size = fitsize(sz);
+  if (! Iter.size) { return NULL; }                         // Too large.
 
   Iter.found = NULL;
 
-  do {
-    Iter.start = umem->start;
-    if (iterate(& Iter)) break;                             // If we had a full scan, don't retry.
-  } while (! Iter.found && ++count < 2);                    // Try 2 times only for a complete scan.
+  if (! pop(& Iter)) {                                      // Nothing from the bins, do a scan.
+    do {
+      Iter.start = umem->start;
+      if (iterate(& Iter)) break;                           // If we had a full scan, don't retry.
+    } while (! Iter.found && ++count < 2);                  // Try 2 times only for a complete scan.
+
+    if (Iter.found && ! unbin(umem, Iter.found, 0)) {       // Can't get it out of its bin without waiting.
+      Iter.found->ciu = 0;                                  // Release claim again.
+      unlock(Iter.found);                                   // Unlock in same sequence.
+      unlock(Iter.succ2found);
+      Iter.found = NULL;
+    }
+  }
 
-  return iter2mem(& Iter, tags);
+  mem = iter2mem(& Iter, tags);
+
+  tally(umem, UMemOp_Fast, Mark);
+
+  return mem;
 
 }
 
 void ufree_fast(umemctx_t umem, void * mem) {               // Uncontended path to release memory.
 
   chunk_t chunk;
-  list_t  list;
-  chunk_t exp;
+  Mark_t  Mark = mark();
 
-  assert(sizeof(List_t) <= minchunksize);                   // Must fit in the minimum chunk.
+  if (mem) {
+    chunk = mem2chunk(mem);
+    assert(chunk->ciu);
+    push2free(umem, chunk);
+  }
+
+  tally(umem, UMemOp_FreeFast, Mark);
+
+}
+
+#if defined(UMEMMAG)
+
+#if defined(UMEMBULK)
+static uint32_t bulk(umemctx_t umem, uint32_t sz, uint32_t num, void * mem[], uint8_t tags, uint32_t fast);
+#endif
+
+static uint32_t class4size(usize_t size) {                 // Return the smallest class that holds size.
+
+  uint32_t c;
+
+  for (c = 0; c < UMAGCLASSES && (minchunksize << c) < size; c++) { }
+
+  return c;                                                 // UMAGCLASSES when too large.
+
+}
+
+void initUMag(umag_t mag, umemctx_t umem) {
+
+  memset(mag, 0x00, sizeof(UMag_t));
+
+  mag->umem = umem;
+
+}
+
+void * umag_malloc(umag_t mag, uint32_t sz, uint8_t tags) {
+
+  uint32_t c = class4size(sz);
+  void *   mem;
+  chunk_t  chunk;
+
+  if (c == UMAGCLASSES) {                                   // Too large for the magazine.
+    return umalloc_fast(mag->umem, sz, tags);
+  }
+
+  if (! mag->num[c]) {                                      // Empty; refill half of the class in one go.
+#if defined(UMEMBULK)                                       // Carved from a single chunk, if there is one, without blocking.
+    mag->num[c] = (uint8_t) bulk(mag->umem, minchunksize << c, UMAGROUNDS / 2, mag->rounds[c], tags, 1);
+#else
+    while (mag->num[c] < UMAGROUNDS / 2) {                  // Without bulk allocation, block by block.
+      mem = umalloc_fast(mag->umem, minchunksize << c, tags);
+      if (! mem) { break; }
+      mag->rounds[c][mag->num[c]++] = mem;
+    }
+#endif
+    if (! mag->num[c]) { return NULL; }
+  }
+
+  mem = mag->rounds[c][--mag->num[c]];                      // Most recently released first.
+  chunk = mem2chunk(mem);
+
+  if (chunk->tags != tags) {                                // Only the owner changes the tags of a used chunk ...
+    while (! trylock(chunk)) { mag->umem->contcb(mag->umem); }  // ... but others lock it while walking.
+    chunk->tags = tags;
+    unlock(chunk);
+  }
+
+  return mem;
+
+}
+
+static void flush(umag_t mag, uint32_t c, uint32_t num) {   // Put the oldest num blocks of a class on the c2free list.
+
+  void * * rounds = mag->rounds[c];
+  uint32_t i;
+
+  assert(num && num <= mag->num[c]);
+
+  for (i = 0; i + 1 < num; i++) {                           // Chain them together ...
+    ((list_t) rounds[i])->next = mem2chunk(rounds[i + 1]);
+  }
+
+  chain2free(mag->umem, mem2chunk(rounds[0]), mem2chunk(rounds[num - 1]));  // ... and release them in one go.
+
+  mag->num[c] = (uint8_t) (mag->num[c] - num);
+  memmove(& rounds[0], & rounds[num], mag->num[c] * sizeof(void *));
+
+}
+
+void umag_free(umag_t mag, void * mem) {
+
+  chunk_t  chunk;
+  uint32_t c;
 
   if (mem) {
-    list = (list_t) mem;
     chunk = mem2chunk(mem);
     assert(chunk->ciu);
-    do {                                                    // Atomically insert in the list.
-      list->next = umem->c2free;                            // Take snapshot and reuse ...
-      exp = list->next;                                     // ... here; do *NOT* read umem->c2free again!
-    } while (! CAX(& umem->c2free, & exp, & chunk));
+    assert((uint8_t *) mem > mag->umem->space && (uint8_t *) mem < mag->umem->space + mag->umem->size);
+    c = class4size(chunk2size(chunk) + 1) - 1;              // Largest class the chunk can serve.
+    if (chunk2size(chunk) < (minchunksize << (c + 1))) {          // Don't cache blocks of twice the class size or more.
+      if (mag->num[c] == UMAGROUNDS) {
+        flush(mag, c, UMAGROUNDS / 2);
+      }
+      mag->rounds[c][mag->num[c]++] = mem;
+    }
+    else {
+      push2free(mag->umem, chunk);
+    }
   }
 
 }
 
+void umag_drain(umag_t mag) {
+
+  for (uint32_t c = 0; c < UMAGCLASSES; c++) {
+    if (mag->num[c]) { flush(mag, c, mag->num[c]); }
+  }
+
+}
+
+#endif // UMEMMAG
+
+#if defined(UMEMBULK)
+
+// Carve num blocks of size bytes from the found chunk of the iterator. The
+// found chunk and its successor are locked; the carved off chunks are locked
+// manually, as they are not reachable yet, and unlocked once the next one has
+// been split off. The last block is handled by iter2mem, which splits off and
+// bins any remainder.
+
+static void carve(umemiter_t iter, usize_t size, uint32_t num, void * mem[], uint8_t tags) {
+
+  chunk_t  c = iter->found;
+  chunk_t  rem;
+  uint32_t i;
+
+  assert(c->lock && c->ciu);
+
+  for (i = 0; i + 1 < num; i++) {
+    rem = split(c, size);
+    rem->ciu = 1; rem->lock = 1;                            // New chunk, lock and claim it manually.
+    atomic_inc32(& iter->umem->numchunks);
+    c->tags = tags;
+    mem[i] = c->u08;
+    if (c != iter->found) { unlock(c); }
+    c = rem;
+  }
+
+  if (c != iter->found) {                                   // Let iter2mem finish the last one.
+    unlock(iter->found);
+    iter->found = c;
+  }
+
+  iter->size = size;
+  mem[i] = iter2mem(iter, tags);
+
+}
+
+// With fast non zero, it follows the rules of umalloc_fast, for the refill of
+// a magazine: no tidying, no waiting for a bin lock and block by block with
+// umalloc_fast when there is no single chunk that can hold all blocks.
+
+static uint32_t bulk(umemctx_t umem, uint32_t sz, uint32_t num, void * mem[], uint8_t tags, uint32_t fast) {
+
+  UMemIter_t Iter = {
+    .umem = umem,
+    .cb   = firstFitCb,
+  };
+
+  usize_t  size = fitsize(sz);
+  usize_t  stride;
+  uint32_t count = 0;
+  uint32_t i = 0;
+  Mark_t   Mark = mark();
+
+  if (! size || ! num) { return 0; }
+
+  stride = roundup(size + chunkhdrsz, 8);                   // Distance between blocks; see split.
+  if ((UMEMMAXSIZE - size - 4) / stride >= num - 1) {       // All of them fit in a single chunk.
+    Iter.size = (num - 1) * stride + size + 4;              // Slack for the alignment check in split.
+    if (! fast) { tidy(umem); }
+    Iter.found = NULL;
+    if (! pop(& Iter)) {                                    // Nothing from the bins, do a scan.
+      do {
+        Iter.start = umem->start;
+        if (iterate(& Iter)) break;                         // If we had a full scan, don't retry.
+      } while (! Iter.found && ++count < 2);
+      if (Iter.found && ! unbin(umem, Iter.found, ! fast)) {  // Can't get it out of its bin without waiting.
+        Iter.found->ciu = 0;                                // Release claim again, as in umalloc_fast.
+        unlock(Iter.found);
+        unlock(Iter.succ2found);
+        Iter.found = NULL;
+      }
+    }
+    if (Iter.found) {
+      carve(& Iter, size, num, mem, tags);
+      i = num;
+    }
+  }
+
+  for ( ; i < num; i++) {                                   // One by one, when no single chunk is big enough.
+    mem[i] = fast ? umalloc_fast(umem, sz, tags) : bestfit(umem, sz, tags);
+    if (! mem[i]) { break; }
+  }
+
+  tally(umem, UMemOp_Bulk, Mark);
+
+  return i;
+
+}
+
+uint32_t umalloc_bulk(umemctx_t umem, uint32_t sz, uint32_t num, void * mem[], uint8_t tags) {
+  return bulk(umem, sz, num, mem, tags, 0);
+}
+
+static void sortmem(void * mem[], uint32_t num) {           // Shell sort on address.
+
+  static const uint32_t Gaps[] = { 701, 301, 132, 57, 23, 10, 4, 1 };
+
+  uint32_t g;
+  uint32_t i;
+  uint32_t j;
+  void *   m;
+
+  for (g = 0; g < sizeof(Gaps) / sizeof(Gaps[0]); g++) {
+    for (i = Gaps[g]; i < num; i++) {
+      m = mem[i];
+      for (j = i; j >= Gaps[g] && (uintptr_t) mem[j - Gaps[g]] > (uintptr_t) m; j -= Gaps[g]) {
+        mem[j] = mem[j - Gaps[g]];
+      }
+      mem[j] = m;
+    }
+  }
+
+}
+
+void ufree_bulk(umemctx_t umem, void * mem[], uint32_t num) {
+
+  chunk_t  c;
+  chunk_t  succ;
+  uint32_t i = 0;
+  Mark_t   Mark = mark();
+
+  sortmem(mem, num);                                        // NULL pointers end up first.
+
+  tidy(umem);
+
+  while (i < num) {
+    if (! mem[i]) { i++; continue; }
+    c = mem2chunk(mem[i++]);
+    assert(c->ciu);
+    while (! trylock(c)) { umem->contcb(umem); }            // Only held shortly, by scans passing by.
+    while (i < num) {                                       // Merge with the blocks that follow it.
+      succ = mem2chunk(mem[i]);
+      if (succ != chunk2succ(c) || ! trylock(succ)) { break; }
+      assert(succ->ciu);
+      merge(c, succ);
+      assert((succ->header = 0, 1));                        // Clear when debugging; succ no longer exists.
+      atomic_dec32(& umem->numchunks);
+      i++;
+    }
+    unlock(c);
+    freechunk(umem, c);                                     // Release the run as a whole.
+  }
+
+  tally(umem, UMemOp_FreeBulk, Mark);
+
+}
+
+#endif // UMEMBULK
+
 #endif // UMEMFAST
 
 #if defined(UREALLOC)
@@ -480,15 +1125,127 @@ static void locktuple(umemctx_t ctx, chunk_t chunk, chunk_t succ) {
 
 }
 
-void * urealloc(umemctx_t ctx, void * mem, uint32_t size, uint8_t tags) {
+static void shrink(umemctx_t ctx, chunk_t chunk, usize_t need) { // Split off the tail of a chunk, if big enough.
+
+  chunk_t  succ;
+  chunk_t  rem;
+  uint32_t bothlocked;
+
+  if (chunk2size(chunk) - need >= enough2split) {           // Remainder big enough to split off?
+    do {
+      bothlocked = 0;
+      if (trylock(chunk)) {
+        succ = chunk2succ(chunk);
+        if (trylock(succ)) {
+          bothlocked = 1;
+          rem = split(chunk, need);
+          succ->prev = rem;
+          succ->pif = 1;
+          atomic_inc32(& ctx->numchunks);
+          binsplit(ctx, rem, succ, 1);
+        }
+        else {                                              // Could not lock successor.
+          unlock(chunk);                                    // Release lock for others to make progress.
+          ctx->contcb(ctx);
+        }
+      }
+    } while (! bothlocked);                                 // Retry locking.
+    unlock(succ);
+    unlock(chunk);
+  }
+
+}
+
+// Grow an in use chunk without allocating a new one. First the free successor
+// is tried; when that is not enough and shift is non zero, also a free
+// predecessor is absorbed, together with a free successor if any, and the
+// contents are moved down into the predecessor. Returns the chunk that now
+// holds the contents, or NULL when it could not grow; the contents are then
+// untouched.
+
+static chunk_t grow(umemctx_t ctx, chunk_t chunk, usize_t need, uint32_t shift) {
 
-  chunk_t  chunk;
   chunk_t  succ;
+  chunk_t  pred;
   chunk_t  rem;
+  chunk_t  grown = NULL;
+  usize_t  size = chunk2size(chunk);                        // Size of an in use chunk is stable.
+  usize_t  room;
   uint32_t bothlocked;
-  void *   newmem = NULL;
 
-  clean(ctx);                                               // Clean any from the free list first.
+  do {
+    bothlocked = 0;
+    if (trylock(chunk)) {
+      succ = chunk2succ(chunk);
+      if (trylock(succ)) {
+        bothlocked = 1;
+      }
+      else {                                                // Could not lock successor.
+        unlock(chunk);                                      // Release lock for others to make progress.
+        ctx->contcb(ctx);
+      }
+    }
+  } while (! bothlocked);                                   // Retry locking.
+
+  room = size + (succ->ciu ? 0 : chunk2size(succ));         // What we can have without moving.
+
+  if (room >= need) {                                       // We can grow into the successor!
+    grown = chunk;
+  }
+  else if (shift && chunk->pif && trylock(chunk->prev)) {   // Pif and prev are stable, as we hold the chunk lock.
+    pred = chunk->prev;
+    assert(! pred->ciu);                                    // Can not be in use when pif is set in our chunk.
+    if (room + chunk2size(pred) + chunkhdrsz >= need) {     // Predecessor, chunk and maybe successor will do.
+      unbin(ctx, pred, 1);                                  // Predecessor will hold the contents.
+      pred->ciu = 1;                                        // Claim it before its bin links are overwritten.
+      pred->tags = chunk->tags;
+      merge(pred, chunk);                                   // Returned successor is invariant.
+      atomic_dec32(& ctx->numchunks);
+      memmove(pred->u08, chunk->u08, size);                 // Overlaps the old header; the successor header is beyond.
+      grown = pred;
+    }
+    else {
+      unlock(pred);
+    }
+  }
+
+  if (grown && ! succ->ciu) {                               // Absorb the free successor too.
+    unbin(ctx, succ, 1);                                    // Successor will be gone.
+    succ = merge(grown, succ);                              // Essentially both merge; succ is the new successor!
+    atomic_dec32(& ctx->numchunks);                         // Since we merged with our successor.
+    if (! trylock(succ)) {                                  // Try to get a lock on the new successor.
+      unlock(grown);
+      locktuple(ctx, grown, succ);                          // Unlock chunk and get both locks.
+    }
+  }
+
+  if (grown) {
+    succ->pif = 0;                                          // Set already in case we don't split next.
+    if (chunk2size(grown) - need >= enough2split) {         // Can we split of a remainder chunk?
+      rem = split(grown, need);
+      succ->prev = rem;
+      succ->pif = 1;
+      atomic_inc32(& ctx->numchunks);                       // One more chunk again, since we just split.
+      binsplit(ctx, rem, succ, 1);
+    }
+  }
+
+  unlock(succ);
+  unlock(grown ? grown : chunk);
+
+  return grown;
+
+}
+
+void * urealloc(umemctx_t ctx, void * mem, uint32_t size, uint8_t tags) {
+
+  chunk_t  chunk;
+  chunk_t  grown;
+  usize_t  need;
+  void *   newmem;
+  Mark_t   Mark = mark();
+
+  tidy(ctx);                                                // Clean any from the free list first.
 
   if (mem) {
     chunk = mem2chunk(mem);
@@ -497,91 +1254,64 @@ void * urealloc(umemctx_t ctx, void * mem, uint32_t size, uint8_t tags) {
       freechunk(ctx, chunk);
       mem = NULL;
     }
-    else if (size > iusize(size)) {                         // Too big for this allocator.
+    else if (0 == (need = fitsize(size))) {                 // Too big for this allocator.
       mem = NULL;
     }
-    else {                                                  // Grow or shrink.
-      if (size < minchunksize) { size = minchunksize; }     // Ensure we have a proper size.
-      size = roundup(size, chunkhdrsz);                     // Align size requirement first.
-      if (chunk->size >= size) {                            // Shrink the current chunk.
-        if (chunk->size - size >= enough2split) {           // Remainder big enough to split off?
-          do {
-            bothlocked = 0;
-            if (trylock(chunk)) {
-              succ = chunk2succ(chunk);
-              if (trylock(succ)) {
-                bothlocked = 1;
-                rem = split(chunk, size);
-                succ->prev = rem;
-                succ->pif = 1;
-                atomic_inc32(& ctx->numchunks);
-              }
-              else {                                        // Could not lock successor.
-                unlock(chunk);                              // Release lock for others to make progress.
-                ctx->contcb(ctx);
-              }
-            }
-          } while (! bothlocked);                           // Retry locking.
-          unlock(succ);
-          unlock(chunk);
-        }
-      }
-      else {                                                // Enlarge current chunk or find a new one.
-        do {
-          bothlocked = 0;
-          if (trylock(chunk)) {
-            succ = chunk2succ(chunk);
-            if (trylock(succ)) {
-              bothlocked = 1;
-              if (! succ->ciu) {                            // Only if successor isn't being used.
-                if (chunk->size + succ->size >= size) {     // We can grow into the successor!
-                  newmem = mem;                             // So we don't need a new memory block.
-                  succ = merge(chunk, succ);                // Essentially both merge; succ is the new successor!
-                  atomic_dec32(& ctx->numchunks);           // Since we merged with our successor.
-                  if (! trylock(succ)) {                    // Try to get a lock on the new successor.
-                    unlock(chunk);
-                    locktuple(ctx, chunk, succ);            // Unlock chunk and get both locks.
-                  }
-                  succ->pif = 0;                            // Set already in case we don't split next.
-                  if (chunk->size - size >= enough2split) { // Can we split of a remainder chunk?
-                    rem = split(chunk, size);
-                    succ->prev = rem;
-                    succ->pif = 1;
-                    atomic_inc32(& ctx->numchunks);         // One more chunk again, since we just split.
-                  }
-                }
-              }
-            }
-            else {                                          // Could not lock successor.
-              unlock(chunk);                                // Release lock for others to make progress.
-              ctx->contcb(ctx);
-            }
-          }
-        } while (! bothlocked);                             // Retry locking.
-        unlock(succ);
-        unlock(chunk);
-        if (! newmem) {                                     // Need to find a new memory block.
-          newmem = umalloc(ctx, size, chunk->tags);
-          if (newmem) {                                     // Copy over the old contents.
-            memcpy(newmem, mem, chunk->size);
-            freechunk(ctx, chunk);                          // Release the old chunk.
-            mem = newmem;
-          }
-          else {
-            mem = NULL;                                     // Reallocation failed.
-          }
-        }
+    else if (chunk2size(chunk) >= need) {                   // Shrink the current chunk.
+      shrink(ctx, chunk, need);
+      tally(ctx, UMemOp_InPlace, mark());
+    }
+    else if (NULL != (grown = grow(ctx, chunk, need, 1))) { // Enlarge current chunk, maybe shifting it down.
+      tally(ctx, grown == chunk ? UMemOp_InPlace : UMemOp_Shifted, mark());
+      mem = grown->u08;
+    }
+    else {                                                  // Need to find a new memory block.
+      newmem = bestfit(ctx, size, chunk->tags);
+      if (newmem) {                                         // Copy over the old contents.
+        memcpy(newmem, mem, chunk2size(chunk));
+        freechunk(ctx, chunk);                              // Release the old chunk.
+        tally(ctx, UMemOp_Moved, mark());
       }
+      mem = newmem;                                         // NULL when reallocation failed.
     }
   }
   else {                                                    // Work as malloc.
-    mem = umalloc(ctx, size, tags);
+    mem = bestfit(ctx, size, tags);
   }
 
+  tally(ctx, UMemOp_Realloc, Mark);
+
   return mem;
 
 }
 
+uint32_t urealloc_try_inplace(umemctx_t ctx, void * mem, uint32_t size) {
+
+  chunk_t  chunk = mem2chunk(mem);
+  usize_t  need = fitsize(size);
+  uint32_t done = 0;
+  Mark_t   Mark = mark();
+
+  assert(chunk->ciu);
+
+  tidy(ctx);                                                // Freed neighbors might become available.
+
+  if (need && chunk2size(chunk) >= need) {
+    shrink(ctx, chunk, need);
+    done = 1;
+  }
+  else if (need) {
+    done = grow(ctx, chunk, need, 0) ? 1 : 0;
+  }
+
+  if (done) { tally(ctx, UMemOp_InPlace, mark()); }
+
+  tally(ctx, UMemOp_Realloc, Mark);
+
+  return done;
+
+}
+
 #endif // UREALLOC
 
 #if defined(UAMALLOC)
@@ -591,7 +1321,7 @@ void * urealloc(umemctx_t ctx, void * mem, uint32_t size, uint8_t tags) {
    chunk as a result of the split. Example
 
    chunk_t  req = NULL;                     // Chunk we want to be aligned.
-   uint32_t size = 512;                     // We need a 512 byte chunk ...
+   usize_t  size = 512;                     // We need a 512 byte chunk ...
    if (split4align(chunk, & size, 256)) {   // ... aligned on a 256 byte boundary.
      if (size) {
        req = split(chunk, size);            // Worked, so we can do the split.
@@ -613,23 +1343,23 @@ void * urealloc(umemctx_t ctx, void * mem, uint32_t size, uint8_t tags) {
    off the chunk, the returned size is set to 0.
 */
 
-static uint32_t split4align(chunk_t chunk, uint32_t *size, uint32_t align) {
+static uint32_t split4align(chunk_t chunk, usize_t *size, uint32_t align) {
 
-  if (chunk->size < *size) { return 0; }                    // Quick check, not big enough.
+  if (chunk2size(chunk) < *size) { return 0; }              // Quick check, not big enough.
 
   Mem_t Mem = { .addr = & chunk->u08[0] };
 
   if (! (Mem.check & (align - 1))) { *size = 0; return 1; } // Already aligned, no need to split.
 
-  Mem.addr += enough2split;                                 // We need at least this to split.
+  Mem.addr += enough2split + chunkhdrsz;                    // We need at least this to split, header included.
 
   Mem.calc = aroundup(Mem.check, align);
 
-  uint32_t b2r = (uint32_t)(Mem.addr - chunk->u08);         // Bytes required for rounding up to alignment.
+  usize_t b2r = (usize_t)(Mem.addr - chunk->u08);           // Bytes required for rounding up to alignment.
 
   b2r -= chunkhdrsz;                                        // Take into account the header for the new chunk.
 
-  if (chunk->size <= b2r + *size) { return 0; }             // Chunk not big enough.
+  if (chunk2size(chunk) < b2r + enough2split + *size) { return 0; } // Chunk not big enough; leave room for the split.
 
   *size = b2r; return 1;                                    // A proper split is possible.
 
@@ -646,14 +1376,14 @@ static uint32_t nextPo2(uint32_t in) {                      // Return the next p
 static UMemItStat_t alignCb(umemiter_t iter, chunk_t c) {   // Find a chunk big enough for alignment.
 
   UMemItStat_t status = UMemIt_Unlock;
-  uint32_t     size;
+  usize_t      size;
 
   assert(c->lock);
   assert(iter->succ == chunk2succ(c));
   assert(iter->succ->lock);
 
-  if (! c->ciu && c->size >= iter->size) {                  // Free and big enough for trying?
-    size = c->size;                                         // Make temporary copy we can pass as reference.
+  if (! c->ciu && chunk2size(c) >= iter->size) {            // Free and big enough for trying?
+    size = iter->size;                                      // Make temporary copy we can pass as reference.
     if (split4align(c, & size, iter->align)) {
       iter->found = c;
       iter->succ2found = iter->succ;
@@ -675,36 +1405,136 @@ void * uamalloc(umemctx_t ctx, uint32_t size, uint8_t tags, uint32_t align) {
     .align = nextPo2(align),
   };
 
-  uint32_t splitat = size;
+  usize_t splitat = size;
+  Mark_t  Mark = mark();
+  void *  mem;
 
   if (8 == Iter.align) { return umalloc(ctx, size, tags); } // Normal alignment, use normal malloc.
 
   search4chunk(& Iter, size, 0);                            // Search for a fitting chunk; no full scan needed.
 
   if (Iter.found) {
+    unbin(ctx, Iter.found, 1);                              // Take it out of its bin.
     split4align(Iter.found, & splitat, Iter.align);         // Call split4align on it again.
     if (splitat) {                                          // splitat can be 0 if already aligned OK.
-      assert(splitat > enough2split);                       // If splitting, broken off front must be large enough.
+      assert(splitat >= enough2split);                      // If splitting, broken off front must be large enough.
       chunk_t chunk = split(Iter.found, splitat);
       assert(chunk);
       atomic_inc32(& ctx->numchunks);
       chunk->ciu = 1; chunk->lock = 1;                      // New chunk, lock and claim it manually.
-      Iter.found->ciu = 0;                                  // Unclaim split-off part.
+      chunk->pif = 1; chunk->prev = Iter.found;             // Its predecessor remains free.
+      Iter.found->ciu = 0;                                  // Unclaim split-off part ...
+      bin(ctx, Iter.found, 1);                              // ... and put it back in a bin.
       unlock(Iter.found);
       Iter.found = chunk;                                   // So that iter2mem can work on it.
       assert(Iter.succ2found == chunk2succ(chunk));         // Successor must be same as before.
     }
   }
 
-  return iter2mem(& Iter, tags);
+  mem = iter2mem(& Iter, tags);
+
+  tally(ctx, UMemOp_Aligned, Mark);
+
+  return mem;
 
 }
 
 #endif // UAMALLOC
 
+#if defined(UMEMSTATS)
+
+void initUMemStats(umemctx_t umem, umemstats_t stats) {
+
+  if (stats) { memset(stats, 0x00, sizeof(UMemStats_t)); }
+
+  umem->stats = stats;
+
+}
+
+typedef struct StatsIter_t {      // Iterator for the ustats walk.
+  UMemIter_t      Iter;           // Must be first; see statsCb.
+  umemreport_t    report;
+} StatsIter_t;
+
+static UMemItStat_t statsCb(umemiter_t iter, chunk_t c) {   // Account for a single chunk.
+
+  umemreport_t report = ((StatsIter_t *) iter)->report;
+  usize_t      size = chunk2size(c);
+  uint32_t     h;
+
+  assert(c->lock);
+
+  if (c->ciu) {
+    report->numused++;
+    report->inuse += size;
+    report->tagged[c->tags] += size;
+  }
+  else {
+    h = (uint32_t) (clz((usize_t) minchunksize) - clz(size));
+    report->histogram[h < UMEMHISTO ? h : UMEMHISTO - 1]++;
+    report->numfree++;
+    report->free += size;
+    if (size > report->largest) { report->largest = size; }
+  }
+
+  return UMemIt_Unlock;
+
+}
+
+uint32_t ustats(umemctx_t umem, umemreport_t report) {
+
+  StatsIter_t    Stats = {
+    .Iter = {
+      .umem = umem,
+      .cb   = statsCb,
+    },
+    .report = report,
+  };
+
+  UMemStripe_t * s;
+  uint32_t       complete = 0;
+  uint32_t       tries;
+  uint32_t       i;
+  uint32_t       op;
+
+  memset(report, 0x00, sizeof(UMemReport_t));
+
+  if (umem->stats) {                                        // Merge the stripes.
+    for (i = 0; i < UMEMSTRIPES; i++) {
+      s = & umem->stats->Stripe[i];
+      for (op = 0; op < UMemOp_Num; op++) {
+        report->calls[op]   += __atomic_load_n(& s->calls[op], __ATOMIC_RELAXED);
+        report->retries[op] += __atomic_load_n(& s->retries[op], __ATOMIC_RELAXED);
+        report->visits[op]  += __atomic_load_n(& s->visits[op], __ATOMIC_RELAXED);
+      }
+    }
+  }
+
+  clean(umem);                                              // Release pending chunks first.
+
+  for (tries = 0; ! complete && tries < umem->breakat; tries++) {
+    report->inuse = report->free = report->largest = 0;     // Restart the walk part of the report.
+    report->numused = report->numfree = 0;
+    memset(report->tagged, 0x00, sizeof(report->tagged));
+    memset(report->histogram, 0x00, sizeof(report->histogram));
+    Stats.Iter.start = umem->start;
+    complete = iterate(& Stats.Iter);
+    if (! complete) { umem->contcb(umem); }
+  }
+
+  if (complete && report->free) {
+    report->frag = (uint32_t) (1000 - (uint64_t) report->largest * 1000 / report->free);
+  }
+
+  return complete;
+
+}
+
+#endif // UMEMSTATS
+
 static void contcb(umemctx_t umem) { (void)umem; }          // Do nothing contention callback.
 
-uint32_t initUMemCtx(umemctx_t ctx, uint8_t space[], uint32_t size) {
+uint32_t initUMemCtx(umemctx_t ctx, uint8_t space[], usize_t size) {
 
   Mem_t    Mem;
   Mem_t    Start;
@@ -713,7 +1543,7 @@ uint32_t initUMemCtx(umemctx_t ctx, uint8_t space[], uint32_t size) {
 
   memset(ctx, 0x00, sizeof(UMemCtx_t));                     // Clear everything.
 
-  if (space && size > 256 && size == iusize(size)) {        // Check if reasonable arguments.
+  if (space && size > 256 && size <= UMEMMAXSPAN) {         // Check if reasonable arguments.
 
     ctx->space = space;
     ctx->size = size;
@@ -722,7 +1552,7 @@ uint32_t initUMemCtx(umemctx_t ctx, uint8_t space[], uint32_t size) {
       Start.chunk = raw2chunk(space, size);
       Mem.addr = & Start.chunk->u08[0];                     // User memory needs to be aligned.
       space++; size--;                                      // 1 byte further/less for next time.
-    } while (Mem.check & 0b111);                            // See if user mem is 8 byte aligned.
+    } while (Mem.check & (startalign - 1));                 // See if user mem is properly aligned.
 
     size++;                                                 // Size was predecremented.
 
@@ -739,16 +1569,16 @@ uint32_t initUMemCtx(umemctx_t ctx, uint8_t space[], uint32_t size) {
     ctx->clean = clean;
     ctx->contcb = contcb;
 
+    size2chunk(start, (size - 2 * chunkhdrsz) / sizeunit * sizeunit - chunkhdrsz);  // End chunk header part of space.
     trylock(start);                                         // Lock required for chunk2succ; should succeed.
-    Mem.chunk = chunk2succ(start);                          // End chunk, but header not part of space.
-    Mem.addr -= 2 * chunkhdrsz;                             // End chunk header now full part of space.
-    start->size = iusize(start->size - 2 * chunkhdrsz);     // Subtracted from total size.
+    Mem.chunk = chunk2succ(start);                          // End chunk.
     Mem.chunk->header = 0;                                  // Clear end chunk header.
     Mem.chunk->pif = 1;                                     // But start chunk starts free.
     Mem.chunk->prev = Start.chunk;
     Mem.chunk->ciu = 1;                                     // End chunk is forever in use.
     ctx->end  = Mem.chunk;
     assert((Mem.chunk->u32[0] = 0, 1));                     // Clear for testing; is checked as invariant.
+    bin(ctx, start, 1);                                     // Start chunk is free.
     unlock(start);
     stat = 1;
   }
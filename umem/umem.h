@@ -9,10 +9,69 @@
 typedef struct Chunk_t *    chunk_t;
 typedef struct UMemCtx_t *  umemctx_t;
 typedef struct UMemIter_t * umemiter_t;
+typedef struct UMemStats_t * umemstats_t;
 
 typedef void     (*umemfun_t)(umemctx_t umem);
 typedef uint32_t (*uiter_t)(umemiter_t iter);
 
+// When UMEMBINS is defined, free chunks are kept on segregated free lists,
+// called bins, so that umalloc_fast can pop a chunk of the right size class
+// instead of walking the chunks from the start chunk. Bin i keeps the free
+// chunks with a size in [2^(i + s), 2^(i + s + 1)), with 2^s the minimum chunk
+// size; the last bin keeps all larger chunks. The links are kept in the user
+// memory of the free chunks, so a free chunk needs room for 2 extra pointers.
+// Define UMEMNOBINS, e.g. with -DUMEMNOBINS, to go without bins.
+
+#if ! defined(UMEMBINS) && ! defined(UMEMNOBINS)
+#define UMEMBINS 24
+#endif
+
+// When UMEMSTATS is defined, operation counters can be attached to a context;
+// see the statistics section at the end. Define UMEMNOSTATS to go without.
+
+#if ! defined(UMEMSTATS) && ! defined(UMEMNOSTATS)
+#define UMEMSTATS
+#endif
+
+// The size field of a chunk holds the span of the chunk, i.e. its header plus
+// the bytes available to the user, in units of UMEMGRAN bytes. By default, the
+// unit is a single byte and the header is 32 bits, with 21 bits for the size,
+// so a chunk, and hence a context, can be at most 2 MByte. Define UMEMGRANULE
+// as 8 or 16, to have the span in units of 8 or 16 bytes; a context can then be
+// 16 or 32 MByte, at the cost of rounding up each request a bit more. Define
+// UMEMHDR64, on 64 bit systems only, for a 64 bit header with 53 bits for the
+// size, so that a single context can manage multi gigabyte regions, e.g. mmap'ed.
+// The umalloc/ufree API does not change; only the sizes of a context and of its
+// chunks become a usize_t.
+
+// #define UMEMGRANULE 16
+// #define UMEMHDR64
+
+#if defined(UMEMGRANULE)
+#if UMEMGRANULE != 8 && UMEMGRANULE != 16
+#error "UMEMGRANULE must be 8 or 16."
+#endif
+#define UMEMGRAN UMEMGRANULE
+#else
+#define UMEMGRAN 1
+#endif
+
+#if defined(UMEMHDR64)
+#if __SIZEOF_POINTER__ != 8
+#error "UMEMHDR64 requires a 64 bit system."
+#endif
+typedef uint64_t uhdr_t;          // Chunk header.
+typedef uint64_t usize_t;         // Sizes of chunks and contexts.
+#define UMEMSIZEBITS 53
+#else
+typedef uint32_t uhdr_t;
+typedef uint32_t usize_t;
+#define UMEMSIZEBITS 21
+#endif
+
+#define UMEMSIZEMASK (((usize_t) 1 << UMEMSIZEBITS) - 1)
+#define UMEMMAXSPAN  (UMEMSIZEMASK / UMEMGRAN * UMEMGRAN)     // Largest span, in bytes, of a chunk.
+
 typedef struct UMemCtx_t {        // Micro Memory Manager Context.
   union {
     uint32_t      count;
@@ -23,44 +82,66 @@ typedef struct UMemCtx_t {        // Micro Memory Manager Context.
   uint8_t         breakat;        // Break ties after this many attempts; default 12.
   uint16_t        tiesbroken;     // Number of times the tie was broken; see umalloc.
   uint32_t        numchunks;      // Total number of chunks.
-  uint32_t        size;           // Total number of bytes at space.
+  uint32_t        budget;         // When non zero, lazy coalescing; see ucoalesce.
+  usize_t         size;           // Total number of bytes at space.
+#if ! defined(UMEMHDR64)
+  uint8_t         pad[4];
+#endif
   umemfun_t       contcb;         // Contention callback; default does nothing.
   umemfun_t       clean;          // Cleanup any chunks on the freelist, if any.
   chunk_t         end;            // Virtual end chunk; size 0 and forever with ciu set.
   chunk_t         start;          // Starting chunk; forever with pif clear.
   chunk_t         c2free;         // List of chunks to be freed.
+  chunk_t         backlog;        // Chunks taken from c2free, not yet released; see ucoalesce.
   uint8_t       * space;          // Space provided by user to be managed.
   uiter_t         iterate;        // Iterate over all chunks.
+#if defined(UMEMSTATS)
+  umemstats_t     stats;          // Operation counters, when attached; see initUMemStats.
+#endif
+#if defined(UMEMBINS)
+  uint32_t        binlocks;       // Micro lock bit for each bin.
+  uint32_t        binmap;         // Bit set when the corresponding bin is not empty.
+  chunk_t         bins[UMEMBINS]; // Segregated free lists; see UMEMBINS.
+#endif
 } UMemCtx_t;
 
 typedef struct Chunk_t {          // ---- Memory of previous chunk -----------------------------
   chunk_t         prev;           // Link to the previous chunk, if pif is set.
   union {                         // ---- Memory of own chunk starts here ----------------------
     volatile struct {
-      uint32_t    ciu  :  1;      // Current in use
-      uint32_t    pif  :  1;      // Previous is free; prev field is valid.
-      uint32_t    lock :  1;
-      uint32_t    size : 21;      // Number of bytes available at u08[0].
-      uint32_t    tags :  8;      // User defined tags.
+      uhdr_t      ciu  :  1;      // Current in use
+      uhdr_t      pif  :  1;      // Previous is free; prev field is valid.
+      uhdr_t      lock :  1;
+      uhdr_t      size : UMEMSIZEBITS;  // Span of the chunk in UMEMGRAN units; see chunk2size.
+      uhdr_t      tags :  8;      // User defined tags.
     };
-    uint32_t      header;
+    uhdr_t        header;
   };
   union {
-    uint8_t       u08[4];         // Actually is at least minchunksize bytes.
-    uint32_t      u32[1];
+    uint8_t       u08[sizeof(uhdr_t)];      // Actually is at least minchunksize bytes.
+    uint32_t      u32[sizeof(uhdr_t) / 4];
   };
 } Chunk_t;
 
-static const uint32_t chunkhdrsz = sizeof(uint32_t);
+static const uint32_t chunkhdrsz = sizeof(uhdr_t);
 
 // Minimum chunk size; it depends on the bit width of the system. We want to
 // avoid memory overhead for embedded systems as much as possible, but we
 // do want all memory allocated blocks to start on a worst case 8 byte aligned
-// boundary; also see the alignedok() function below.
+// boundary; also see the alignedok() function below. With bins, a free chunk
+// holds the 2 bin links and the prev field of its successor, at the end.
 
+#if defined(UMEMBINS)
+static const uint32_t minchunksize = 3 * sizeof(void *);
+#else
 static const uint32_t minchunksize = sizeof(void *);
+#endif
+
+#define iusize(S) ({ UMEMSIZEMASK & ((usize_t) S); })      // Mask for the size field.
 
-#define iusize(S) ({ 0x001fffffu & ((uint32_t) S); })
+// Largest number of bytes a single chunk can give to the user.
+
+#define UMEMMAXSIZE (UMEMMAXSPAN - chunkhdrsz)
 
 typedef enum {
   UMemIt_Stop     = 0,            // Stop iteration; *keep* current locks; iterate returns 0!
@@ -77,8 +158,10 @@ typedef struct UMemIter_t {       // UMem Iteration Context.
   chunk_t         succ;           // [Set by iterator] The locked successor of the passed chunk.
   chunk_t         found;          // During allocation, chunk that fits the size.
   chunk_t         succ2found;     // Successor of the found chunk, if any.
+#if ! defined(UMEMHDR64)
   uint8_t         pad[4];
-  uint32_t        size;           // In search4chunk, required size.
+#endif
+  usize_t         size;           // In search4chunk, required size.
   uint32_t        count;          // Generic counter; available to callback.
   uint32_t        align;          // In search4chunk, alignment required; only used for uamalloc.
 } UMemIter_t;
@@ -113,6 +196,19 @@ typedef union Mem_t {             // Memory calculation union.
 
 */
 
+inline static usize_t chunk2size(chunk_t chunk) {          // Number of bytes available at u08[0].
+  return (usize_t) chunk->size * UMEMGRAN - chunkhdrsz;
+}
+
+inline static void size2chunk(chunk_t chunk, usize_t size) {  // Set number of bytes available at u08[0].
+
+  assert(! ((size + chunkhdrsz) % UMEMGRAN));               // Span must be a whole number of units.
+  assert(size + chunkhdrsz <= UMEMMAXSPAN);
+
+  chunk->size = iusize((size + chunkhdrsz) / UMEMGRAN);
+
+}
+
 inline static chunk_t mem2chunk(void * mem) {
 
   Mem_t Mem = { .mem = mem };
@@ -152,7 +248,7 @@ inline static chunk_t chunk2succ(chunk_t chunk) {
 
   assert(chunk->lock);                                      // Size should not change under our feet.
 
-  Mem.addr += chunk->size + chunkhdrsz;
+  Mem.addr += (usize_t) chunk->size * UMEMGRAN;
 
   return Mem.chunk;
 
@@ -176,17 +272,17 @@ inline static chunk_t chunk2succ(chunk_t chunk) {
 
 */
 
-inline static chunk_t raw2chunk(uint8_t bytes[], uint32_t num) {
+inline static chunk_t raw2chunk(uint8_t bytes[], usize_t num) {
 
   Mem_t Mem = { .addr = bytes };
 
   Mem.addr -= sizeof(chunk_t);
 
-  assert(& Mem.chunk->header == (uint32_t *) bytes);
+  assert(& Mem.chunk->header == (uhdr_t *) bytes);
 
-  assert(iusize(num) == num);
+  assert(num <= UMEMMAXSPAN);
 
-  Mem.chunk->size = iusize(num - chunkhdrsz);
+  size2chunk(Mem.chunk, num / UMEMGRAN * UMEMGRAN - chunkhdrsz);  // Whole number of units.
 
   Mem.chunk->pif  = 0;
   Mem.chunk->ciu  = 0;
@@ -206,7 +302,7 @@ inline static uint32_t alignedok(void * mem) {              // Return non zero w
 
 // Initialize a context; returns zero when passed space is too small.
 
-uint32_t initUMemCtx(umemctx_t umem, uint8_t space[], uint32_t sz);
+uint32_t initUMemCtx(umemctx_t umem, uint8_t space[], usize_t sz);
 
 // Basic allocation function; it does NOT clear the allocated memory. It searches
 // for a best fitting chunk, unless there is high contention. Under high contention
@@ -219,11 +315,29 @@ void * umalloc(umemctx_t umem, uint32_t sz, uint8_t tags);
 
 void ufree(umemctx_t umem, void * mem);
 
+/*
+  Chunks on the c2free list, e.g. released by ufree_fast, are normally all
+  released and coalesced by the next umalloc, ufree or urealloc; that puts
+  the cost of the whole list on an unrelated caller. When the budget field of
+  the context is set to a non zero value, these operations release at most
+  budget chunks; the rest is left for ucoalesce. Call ucoalesce regularly, e.g.
+  from an idle thread or a timer callback, to release at most budget chunks in
+  one step. Chunks that were taken but not released within the budget are kept
+  on the backlog, for the next step. Only one caller at a time works on the
+  backlog; a concurrent ucoalesce returns without doing anything. When umalloc
+  can not find a chunk while chunks are still waiting, it will release them all
+  and search again. Returns non zero when chunks remain to be released.
+*/
+
+uint32_t ucoalesce(umemctx_t umem, uint32_t budget);
+
 #define UMEMFAST
 
 #if defined(UMEMFAST)
 
 // A malloc version that only does a first fit for a matching chunk; faster than umalloc.
+// With UMEMBINS, it first tries to pop a chunk from the bins; only when that fails, e.g.
+// because of contention, it falls back on a first fit scan.
 
 void * umalloc_fast(umemctx_t umem, uint32_t sz, uint8_t tags);
 
@@ -232,6 +346,71 @@ void * umalloc_fast(umemctx_t umem, uint32_t sz, uint8_t tags);
 
 void ufree_fast(umemctx_t umem, void * mem);
 
+/*
+  When UMEMMAG is defined, a magazine layer is build on top of umalloc_fast and
+  ufree_fast. A magazine is a small cache of blocks, for a few size classes,
+  that is owned by a single thread; e.g. keep it in the thread context. So it
+  needs no locking at all. Allocating from a magazine pops the most recently
+  released block of the size class, if any; when empty, the class is refilled
+  with a batch of blocks in one go, carved from a single free chunk when
+  UMEMBULK is defined and there is one, under the rules of umalloc_fast. Releasing into a magazine pushes the block
+  onto its class; when full, the oldest half of the class is put on the c2free
+  list of the context, with a single atomic operation.
+
+  Class c holds blocks of minchunksize << c bytes; larger blocks are passed
+  straight to umalloc_fast and ufree_fast. Blocks in a magazine are still in use
+  for the context, so drain the magazine with umag_drain before e.g. checking
+  for leaks or when the owning thread stops. Only release blocks into a
+  magazine that were allocated from the same context the magazine is using.
+  Define UMEMNOMAG to go without magazines.
+*/
+
+#if ! defined(UMEMMAG) && ! defined(UMEMNOMAG)
+#define UMEMMAG
+#endif
+
+#if defined(UMEMMAG)
+
+#define UMAGCLASSES 6             // Number of size classes in a magazine.
+#define UMAGROUNDS  16            // Number of blocks a size class can hold.
+
+typedef struct UMag_t * umag_t;
+
+typedef struct UMag_t {           // Magazine; owned by a single thread.
+  umemctx_t       umem;           // Context to refill from and flush to.
+  uint8_t         num[UMAGCLASSES];  // Number of blocks in each class.
+  uint8_t         pad[2];
+  void *          rounds[UMAGCLASSES][UMAGROUNDS];
+} UMag_t;
+
+void   initUMag(umag_t mag, umemctx_t umem);
+void * umag_malloc(umag_t mag, uint32_t sz, uint8_t tags);
+void   umag_free(umag_t mag, void * mem);
+void   umag_drain(umag_t mag);    // Release all blocks held by the magazine.
+
+#endif // UMEMMAG
+
+/*
+  When UMEMBULK is defined, a burst of equally sized blocks can be allocated
+  and released in one go. umalloc_bulk looks for a single free chunk that can
+  hold all num blocks, with one scan, and carves the blocks from it, while
+  keeping it locked; when there is no such chunk, the blocks are allocated one
+  by one. It returns the number of blocks stored in mem; fewer than num when
+  out of memory. ufree_bulk sorts the passed array on address, in place, and
+  merges runs of neighboring blocks, before releasing each run as a whole.
+  The array can contain NULL pointers; they are skipped. Define UMEMNOBULK to
+  go without them.
+*/
+
+#if ! defined(UMEMBULK) && ! defined(UMEMNOBULK)
+#define UMEMBULK
+#endif
+
+#if defined(UMEMBULK)
+uint32_t umalloc_bulk(umemctx_t umem, uint32_t sz, uint32_t num, void * mem[], uint8_t tags);
+void     ufree_bulk(umemctx_t umem, void * mem[], uint32_t num);
+#endif // UMEMBULK
+
 #endif // UMEMFAST
 
 /*
@@ -245,6 +424,16 @@ void ufree_fast(umemctx_t umem, void * mem);
   a block that has been allocated with uamalloc and ask it for increasing the
   block, there is NO guarantee that the newly returned block is allocated
   at the proper boundary.
+
+  For increasing, urealloc first tries to grow into a free successor chunk.
+  When that is not enough, it tries to absorb a free predecessor chunk as
+  well, and moves the contents down with a memmove; only when that also
+  fails, a new block is allocated, the contents are copied and the old block
+  is released. The urealloc_try_inplace variant never moves the contents;
+  it returns non zero when the block could be resized at the same address
+  and zero when not, leaving the block untouched. Use it e.g. for a growing
+  vector that would rather allocate a bigger block itself. With statistics
+  attached, the InPlace, Shifted and Moved operations count the outcomes.
 */
 
 #define UREALLOC 1
@@ -252,6 +441,7 @@ void ufree_fast(umemctx_t umem, void * mem);
 #if defined(UREALLOC)
 
 void * urealloc(umemctx_t ctx, void * mem, uint32_t size, uint8_t tags);
+uint32_t urealloc_try_inplace(umemctx_t ctx, void * mem, uint32_t size);
 
 #endif // UREALLOC
 
@@ -273,4 +463,82 @@ void * uamalloc(umemctx_t ctx, uint32_t sz, uint8_t tags, uint32_t align);
 
 #endif // UAMALLOC
 
+/*
+  When UMEMSTATS is defined, a statistics block can be attached to a context
+  with initUMemStats. Each operation then counts its calls, its failed micro
+  lock attempts, called retries, and the number of chunks its scans visited.
+  The counters are kept in UMEMSTRIPES stripes of their own cache lines; each
+  thread adds to its own stripe, so threads hardly ever touch the same cache
+  line. The stripes are only merged when reading them with ustats.
+
+  The ustats function also walks all chunks, after cleaning the c2free list,
+  to report the bytes in use per tag, a histogram of the free chunk sizes, the
+  largest free chunk and the external fragmentation, in permille, i.e.
+  1000 * (1 - largest / free). The walk locks the chunks one by one, like any
+  scan, so it is meant to be called now and then, e.g. from a monitor thread.
+  Counters of an operation include the work of any nested operation, e.g. the
+  ufree done by urealloc when it had to move the block.
+*/
+
+#if defined(UMEMSTATS)
+
+#define UMEMSTRIPES 8             // Number of counter stripes.
+#define UMEMHISTO   24            // Number of power of 2 classes in the histogram.
+
+typedef enum {                    // Operations being counted.
+  UMemOp_Malloc   = 0,
+  UMemOp_Fast     = 1,            // umalloc_fast
+  UMemOp_Free     = 2,
+  UMemOp_FreeFast = 3,            // ufree_fast
+  UMemOp_Realloc  = 4,
+  UMemOp_Aligned  = 5,            // uamalloc
+  UMemOp_Bulk     = 6,            // umalloc_bulk
+  UMemOp_FreeBulk = 7,            // ufree_bulk
+  UMemOp_InPlace  = 8,            // urealloc or urealloc_try_inplace kept the block address.
+  UMemOp_Shifted  = 9,            // urealloc grew into the predecessor and moved the contents down.
+  UMemOp_Moved    = 10,           // urealloc allocated a new block and copied the contents.
+  UMemOp_Num      = 11,
+} UMemOp_t;
+
+typedef struct UMemStripe_t {     // Counters of the threads that map onto this stripe.
+  uint64_t        calls[UMemOp_Num];
+  uint64_t        retries[UMemOp_Num];
+  uint64_t        visits[UMemOp_Num];
+  uint8_t         pad[(64 - (3 * UMemOp_Num * sizeof(uint64_t)) % 64) % 64];
+} __attribute__((aligned(64))) UMemStripe_t;
+
+typedef struct UMemStats_t {      // Statistics block; see initUMemStats.
+  UMemStripe_t    Stripe[UMEMSTRIPES];
+} UMemStats_t;
+
+typedef struct UMemReport_t * umemreport_t;
+
+typedef struct UMemReport_t {     // Snapshot returned by ustats.
+  uint64_t        calls[UMemOp_Num];    // Number of calls per operation.
+  uint64_t        retries[UMemOp_Num];  // Failed micro lock attempts per operation.
+  uint64_t        visits[UMemOp_Num];   // Chunks visited per operation; divide by calls for the average.
+  usize_t         inuse;          // Bytes in chunks in use.
+  usize_t         free;           // Bytes available in free chunks.
+  usize_t         largest;        // Size of the largest free chunk.
+  usize_t         tagged[256];    // Bytes in use per tags value.
+  uint32_t        numused;        // Number of chunks in use.
+  uint32_t        numfree;        // Number of free chunks.
+  uint32_t        frag;           // External fragmentation in permille.
+  uint32_t        histogram[UMEMHISTO]; // Free chunks per power of 2 class; class 0 is minchunksize.
+#if defined(UMEMHDR64)
+  uint8_t         pad[4];
+#endif
+} UMemReport_t;
+
+// Attach a statistics block to a context and clear it; pass NULL to detach.
+
+void initUMemStats(umemctx_t umem, umemstats_t stats);
+
+// Fill in the report. Returns non zero when all chunks could be walked; when
+// zero, only the counters are valid, e.g. because of too much contention.
+
+uint32_t ustats(umemctx_t umem, umemreport_t report);
+
+#endif // UMEMSTATS
+
 #endif // UMEMMAN_H